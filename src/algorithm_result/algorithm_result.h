@@ -3,10 +3,19 @@
 
 #include <vector>
 
+#include "../histogram/histogram.h"
+#include "../perf_counters/perf_counters.h"
 #include "../time_range/time_range.h"
 
 namespace s21 {
 
+constexpr double kPrintedPercentiles[] = {50, 90, 99, 99.9};
+
+// The timestamps of the iterations are kept as a histogram of
+// microseconds, so a result takes the same memory for any number of
+// iterations while its percentiles stay within 2% of the recorded times.
+// The perf counters of the iterations are summed, those of the workers are
+// kept per worker index, summed over the iterations
 template <class T>
 class AlgorithmResult {
  public:
@@ -18,10 +27,17 @@ class AlgorithmResult {
 
   // Methods
   void AddTimestamp(const TimeRange& time_range);
+  void AddCounters(const PerfSample& sample);
+  void AddThreadCounters(const std::vector<PerfSample>& samples);
+  PerfSample CalculateAverageCounters() const;  // per iteration
   TimeRange CalculateAverageTime() const;
+  TimeRange CalculatePercentileTime(const double percentile) const;
+  double CalculateStandardDeviation() const;  // in microseconds
   void Reset();
   void PrintTotalExecutionTime() const;
   void PrintAverageTime() const;
+  void PrintTimeDistribution() const;
+  void PrintCounters() const;
 
   // Setters
   void SetSolution(const solution_type& solution);
@@ -30,9 +46,17 @@ class AlgorithmResult {
   // Getters
   solution_type GetSolution() const;
   TimeRange GetTotalExecutionTime() const;
+  TimeRange GetMinimumTime() const;
+  TimeRange GetMaximumTime() const;
+  int64_t GetTimestampsQuantity() const;
+  const Histogram& GetTimeHistogram() const;
+  const PerfSample& GetCounters() const;
+  const std::vector<PerfSample>& GetThreadCounters() const;
 
  private:
-  std::vector<TimeRange> timestamps_;
+  Histogram time_histogram_;  // of the timestamps in microseconds
+  PerfSample counters_;
+  std::vector<PerfSample> thread_counters_;
   TimeRange total_execution_time_;
   solution_type solution_;
 };
@@ -49,32 +73,63 @@ struct AlgorithmResults {
 // Methods
 template <typename T>
 void AlgorithmResult<T>::AddTimestamp(const TimeRange& time_range) {
-  timestamps_.push_back(time_range);
+  time_histogram_.Record(time_range.GetMicroseconds());
 }
 
 template <typename T>
-TimeRange AlgorithmResult<T>::CalculateAverageTime() const {
-  TimeRange time_range;
-  int64_t seconds_sum = 0;
-  int64_t milliseconds_sum = 0;
-  int64_t microseconds_sum = 0;
-  for (const TimeRange& time_range : timestamps_) {
-    seconds_sum += time_range.GetSeconds();
-    milliseconds_sum += time_range.GetMilliseconds();
-    microseconds_sum += time_range.GetMicroseconds();
+void AlgorithmResult<T>::AddCounters(const PerfSample& sample) {
+  counters_ += sample;
+}
+
+// Workers that did not count leave their slot as it was
+template <typename T>
+void AlgorithmResult<T>::AddThreadCounters(
+    const std::vector<PerfSample>& samples) {
+  for (size_t i = 0; i < samples.size(); ++i) {
+    if (samples[i].samples_quantity == 0) continue;
+    if (thread_counters_.size() <= i) {
+      thread_counters_.resize(i + 1);
+    }
+    thread_counters_[i] += samples[i];
+  }
+}
+
+template <typename T>
+PerfSample AlgorithmResult<T>::CalculateAverageCounters() const {
+  PerfSample average = counters_;
+  if (average.samples_quantity > 1) {
+    for (int64_t& value : average.values) {
+      value /= average.samples_quantity;
+    }
+    average.samples_quantity = 1;
   }
-  int64_t average_seconds = seconds_sum / timestamps_.size();
-  int64_t average_milliseconds = milliseconds_sum / timestamps_.size();
-  int64_t average_microseconds = microseconds_sum / timestamps_.size();
-  time_range.SetSeconds(average_seconds);
-  time_range.SetMilliseconds(average_milliseconds);
-  time_range.SetMicroseconds(average_microseconds);
-  return time_range;
+  return average;
+}
+
+// The mean of the microseconds, rounded once, zero without timestamps
+template <typename T>
+TimeRange AlgorithmResult<T>::CalculateAverageTime() const {
+  return TimeRange(
+      std::chrono::microseconds(std::llround(time_histogram_.GetMean())));
+}
+
+template <typename T>
+TimeRange AlgorithmResult<T>::CalculatePercentileTime(
+    const double percentile) const {
+  return TimeRange(std::chrono::microseconds(
+      time_histogram_.CalculatePercentile(percentile)));
+}
+
+template <typename T>
+double AlgorithmResult<T>::CalculateStandardDeviation() const {
+  return time_histogram_.GetStandardDeviation();
 }
 
 template <typename T>
 void AlgorithmResult<T>::Reset() {
-  timestamps_.clear();
+  time_histogram_.Reset();
+  counters_ = PerfSample();
+  thread_counters_.clear();
 }
 
 template <typename T>
@@ -98,6 +153,49 @@ void AlgorithmResult<T>::PrintAverageTime() const {
             << std::endl;
 }
 
+template <typename T>
+void AlgorithmResult<T>::PrintTimeDistribution() const {
+  std::cout << "Minimum time in microseconds: "
+            << GetMinimumTime().GetMicroseconds() << std::endl;
+  for (double percentile : kPrintedPercentiles) {
+    std::cout << "p" << percentile << " time in microseconds: "
+              << CalculatePercentileTime(percentile).GetMicroseconds()
+              << std::endl;
+  }
+  std::cout << "Maximum time in microseconds: "
+            << GetMaximumTime().GetMicroseconds() << std::endl;
+  std::cout << "Standard deviation in microseconds: "
+            << CalculateStandardDeviation() << std::endl;
+}
+
+// Only the available events are printed, the workers that counted after
+// the iterations
+template <typename T>
+void AlgorithmResult<T>::PrintCounters() const {
+  PerfSample average = CalculateAverageCounters();
+  if (!average.IsAnyAvailable()) {
+    std::cout << "Perf counters are unavailable" << std::endl;
+    return;
+  }
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    if (average.is_available[i]) {
+      std::cout << "Average " << kPerfEventNames[i]
+                << " per iteration: " << average.values[i] << std::endl;
+    }
+  }
+  for (size_t thread = 0; thread < thread_counters_.size(); ++thread) {
+    const PerfSample& sample = thread_counters_[thread];
+    if (!sample.IsAnyAvailable()) continue;
+    std::cout << "Worker " << thread << ":";
+    for (int i = 0; i < kPerfEventsQuantity; ++i) {
+      if (sample.is_available[i]) {
+        std::cout << " " << kPerfEventNames[i] << " " << sample.values[i];
+      }
+    }
+    std::cout << std::endl;
+  }
+}
+
 // Setters
 template <typename T>
 void AlgorithmResult<T>::SetSolution(const solution_type& solution) {
@@ -121,6 +219,37 @@ TimeRange AlgorithmResult<T>::GetTotalExecutionTime() const {
   return total_execution_time_;
 }
 
+template <typename T>
+TimeRange AlgorithmResult<T>::GetMinimumTime() const {
+  return TimeRange(std::chrono::microseconds(time_histogram_.GetMinimum()));
+}
+
+template <typename T>
+TimeRange AlgorithmResult<T>::GetMaximumTime() const {
+  return TimeRange(std::chrono::microseconds(time_histogram_.GetMaximum()));
+}
+
+template <typename T>
+int64_t AlgorithmResult<T>::GetTimestampsQuantity() const {
+  return time_histogram_.GetCount();
+}
+
+template <typename T>
+const Histogram& AlgorithmResult<T>::GetTimeHistogram() const {
+  return time_histogram_;
+}
+
+template <typename T>
+const PerfSample& AlgorithmResult<T>::GetCounters() const {
+  return counters_;
+}
+
+template <typename T>
+const std::vector<PerfSample>& AlgorithmResult<T>::GetThreadCounters()
+    const {
+  return thread_counters_;
+}
+
 }  // namespace s21
 
 #endif  // ALGORITHM_RESULT_ALGORITHM_RESULT_H_
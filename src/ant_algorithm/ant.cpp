@@ -0,0 +1,78 @@
+#include "ant.h"
+
+using s21::ant::Ant;
+
+// Methods
+void Ant::Reset(const size_type vertices_quantity,
+                const size_type first_vertex) {
+  visited_.assign((vertices_quantity + 63) / 64, 0);
+  unvisited_.resize(vertices_quantity);
+  positions_.resize(vertices_quantity);
+  for (size_type vertex = 0; vertex < vertices_quantity; ++vertex) {
+    unvisited_[vertex] = vertex;
+    positions_[vertex] = vertex;
+  }
+  tour_.clear();
+  tour_.reserve(vertices_quantity + 1);
+  deposits_.clear();
+  distance_ = INFINITY;
+  Visit(first_vertex);
+}
+
+void Ant::Visit(const size_type vertex) {
+  visited_[vertex >> 6] |= uint64_t{1} << (vertex & 63);
+  size_type position = positions_[vertex];
+  size_type last = unvisited_.back();
+  unvisited_[position] = last;
+  positions_[last] = position;
+  unvisited_.pop_back();
+  tour_.push_back(vertex);
+}
+
+void Ant::CloseTour() { tour_.push_back(tour_.front()); }
+
+void Ant::SetDistance(const double distance) { distance_ = distance; }
+
+// Takes an improved tour, the deposits of the old one are dropped
+void Ant::ReplaceTour(const std::vector<size_type>& tour,
+                      const double distance) {
+  tour_ = tour;
+  distance_ = distance;
+  deposits_.clear();
+}
+
+void Ant::AddDeposit(const size_type from, const size_type to,
+                     const double delta) {
+  deposits_.push_back(Deposit{from, to, delta});
+}
+
+bool Ant::IsVisited(const size_type vertex) const {
+  return (visited_[vertex >> 6] >> (vertex & 63)) & 1;
+}
+
+bool Ant::HasUnvisited() const { return !unvisited_.empty(); }
+
+void Ant::Seed(const uint64_t seed) { engine_.seed(seed); }
+
+double Ant::GetRandomNumber() {
+  return static_cast<double>(engine_() >> 11) * 0x1.0p-53;
+}
+
+// Getters
+const std::vector<typename Ant::size_type>& Ant::GetUnvisited() const {
+  return unvisited_;
+}
+
+const uint64_t* Ant::GetVisited() const { return visited_.data(); }
+
+const std::vector<typename Ant::size_type>& Ant::GetTour() const {
+  return tour_;
+}
+
+const std::vector<s21::ant::Deposit>& Ant::GetDeposits() const {
+  return deposits_;
+}
+
+double Ant::GetDistance() const { return distance_; }
+
+s21::ant::Roulette& Ant::GetRoulette() { return roulette_; }
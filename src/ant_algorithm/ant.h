@@ -0,0 +1,67 @@
+#ifndef ANT_ALGORITHM_ANT_H_
+#define ANT_ALGORITHM_ANT_H_
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "roulette.h"
+
+namespace s21 {
+
+namespace ant {
+
+// Pheromone to add on the edge between two vertices, in both directions
+struct Deposit {
+  int from;
+  int to;
+  double delta;
+};
+
+// Tour under construction. Visited vertices are kept in a bitset and the
+// unvisited ones in a list with O(1) removal, both reused between tours.
+// Pheromone deposits of the tour stay with the ant until the colony merges
+// them after a batch. Every ant draws from its own generator, so ants of
+// different threads do not share random state
+class Ant {
+ public:
+  using size_type = int;
+
+ public:
+  // Methods
+  void Reset(const size_type vertices_quantity, const size_type first_vertex);
+  void Visit(const size_type vertex);
+  void CloseTour();
+  void SetDistance(const double distance);
+  void ReplaceTour(const std::vector<size_type>& tour, const double distance);
+  void AddDeposit(const size_type from, const size_type to, const double delta);
+  bool IsVisited(const size_type vertex) const;
+  bool HasUnvisited() const;
+  void Seed(const uint64_t seed);
+  double GetRandomNumber();  // uniform in [0, 1) with 53 random bits
+
+  // Getters
+  const std::vector<size_type>& GetUnvisited() const;
+  const uint64_t* GetVisited() const;  // bitset of the visited vertices
+  const std::vector<size_type>& GetTour() const;
+  const std::vector<Deposit>& GetDeposits() const;
+  double GetDistance() const;
+  Roulette& GetRoulette();
+
+ private:
+  std::vector<uint64_t> visited_;
+  std::vector<size_type> unvisited_;
+  std::vector<size_type> positions_;  // index of a vertex in unvisited_
+  std::vector<size_type> tour_;
+  std::vector<Deposit> deposits_;
+  double distance_{INFINITY};  // infinite until the tour is completed
+  Roulette roulette_;
+  std::mt19937_64 engine_;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_ANT_H_
@@ -5,250 +5,629 @@ using s21::ant::AntAlgorithm;
 typename AntAlgorithm::result_type
 AntAlgorithm::SolveTravelingSalesmanProblemSequently(
     const s21::Matrix& graph, const int iterations_quantity) {
+  return SolveTravelingSalesmanProblemSequently(GetPreparedGraph(graph),
+                                                iterations_quantity);
+}
+
+typename AntAlgorithm::result_type
+AntAlgorithm::SolveTravelingSalesmanProblemInParallel(
+    const Matrix& graph, const int iterations_quantity) {
+  return SolveTravelingSalesmanProblemInParallel(GetPreparedGraph(graph),
+                                                 iterations_quantity);
+}
+
+// A prepared graph skips the validation and the statistics of the graph,
+// its candidates quantity is used instead of the one set on the colony
+typename AntAlgorithm::result_type
+AntAlgorithm::SolveTravelingSalesmanProblemSequently(
+    std::shared_ptr<const PreparedGraph> graph,
+    const int iterations_quantity) {
   std::function<void()> solving_method =
       std::bind(&AntAlgorithm::SolveSequently, this);
+  threads_quantity_ = 1;
   Solve(graph, solving_method, iterations_quantity);
   return result_;
 }
 
 typename AntAlgorithm::result_type
 AntAlgorithm::SolveTravelingSalesmanProblemInParallel(
-    const Matrix& graph, const int iterations_quantity) {
+    std::shared_ptr<const PreparedGraph> graph,
+    const int iterations_quantity) {
   std::function<void()> solving_method =
       std::bind(&AntAlgorithm::SolveInParallel, this);
+  threads_quantity_ = kThreadsQuantity;
   Solve(graph, solving_method, iterations_quantity);
   return result_;
 }
 
-void AntAlgorithm::Solve(const Matrix& graph,
+void AntAlgorithm::Solve(std::shared_ptr<const PreparedGraph> graph,
                          std::function<void()> solving_method,
                          const int iterations_quantity) {
+  result_.Reset();
+  tsm_result_ = TsmResult();
+  completed_ants_ = 0;
+  solve_timer_.Begin();
   Timer total_time_timer;
   Timer average_time_timer;
+  PerfCounters iteration_counters(true);
   total_time_timer.Begin();
+  prepared_graph_ = graph;
+  vertices_ = &prepared_graph_->GetGraph();
+  lower_bound_ = IsLowerBoundNeeded()
+                     ? prepared_graph_->GetLowerBound(threads_quantity_)
+                     : 0;
   for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
     average_time_timer.Begin();
-    Setup(graph);
+    Setup();
     solving_method();
     s21::TimeRange timestamp = average_time_timer.Timestamp();
     result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+    if (IsCancelled()) {
+      break;
+    }
   }
+  tsm_result_.lower_bound = lower_bound_;
+  tsm_result_.gap = CalculateGap(tsm_result_.distance, lower_bound_);
   s21::TimeRange timestamp = total_time_timer.Timestamp();
   result_.SetTotalExecutionTime(timestamp);
   result_.SetSolution(tsm_result_);
 }
 
-void AntAlgorithm::SolveSequently() {
-  int iterations_quantity = kIterationsQuantity;
-  while (iterations_quantity--) {
-    AntPassage();
-  }
-}
-
-void AntAlgorithm::SolveInParallel() {
-  int iterations_quantity = kIterationsQuantity;
-  while (iterations_quantity > 0) {
-    std::thread t0(&AntAlgorithm::AntPassage, this);
-    std::thread t1(&AntAlgorithm::AntPassage, this);
-    std::thread t2(&AntAlgorithm::AntPassage, this);
-    std::thread t3(&AntAlgorithm::AntPassage, this);
-    std::thread t4(&AntAlgorithm::AntPassage, this);
-    std::thread t5(&AntAlgorithm::AntPassage, this);
-    std::thread t6(&AntAlgorithm::AntPassage, this);
-    std::thread t7(&AntAlgorithm::AntPassage, this);
-    t0.join();
-    t1.join();
-    t2.join();
-    t3.join();
-    t4.join();
-    t5.join();
-    t6.join();
-    t7.join();
-    mtx_.lock();
-    AddPheromoneChange();
-    mtx_.unlock();
-    iterations_quantity -= kThreadsQuantity;
-  }
-}
-
-void AntAlgorithm::AntPassage() {
-  std::vector<int>* visited_vertices = new std::vector<int>;
-  double current_dictance = 0;
-  int current_vertex = 0, first_vertex = 0, next_vertex = 0;
+// Re-solves the graph of the last solve after its edges changed. The
+// colony keeps its pheromones and its best tour, repriced on the new
+// weights, and only the trails around the changed edges move back towards
+// the initial pheromone, so a few batches adapt the previous solution
+typename AntAlgorithm::result_type
+AntAlgorithm::ReoptimizeTravelingSalesmanProblemSequently(
+    const std::vector<EdgeChange>& changes, const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&AntAlgorithm::SolveSequently, this);
+  threads_quantity_ = 1;
+  Reoptimize(changes, solving_method, iterations_quantity);
+  return result_;
+}
 
-  visited_vertices->push_back(current_vertex);
-  next_vertex = GetNextVertex(current_vertex, visited_vertices);
+typename AntAlgorithm::result_type
+AntAlgorithm::ReoptimizeTravelingSalesmanProblemInParallel(
+    const std::vector<EdgeChange>& changes, const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&AntAlgorithm::SolveInParallel, this);
+  threads_quantity_ = kThreadsQuantity;
+  Reoptimize(changes, solving_method, iterations_quantity);
+  return result_;
+}
 
-  while (visited_vertices->size() != vertices_.GetRows()) {
-    if (WasNotVisited(next_vertex, visited_vertices)) {
-      visited_vertices->push_back(next_vertex);
-      current_dictance += vertices_(current_vertex, next_vertex);
+// Every iteration starts from the same warm pheromones. A previous tour
+// that lost an edge is dropped, any other one is repaired
+void AntAlgorithm::Reoptimize(const std::vector<EdgeChange>& changes,
+                              std::function<void()> solving_method,
+                              const int iterations_quantity) {
+  if (prepared_graph_ == nullptr ||
+      pheromones_.GetRows() != prepared_graph_->GetSize()) {
+    throw s21::NothingToReoptimize();
+  }
+  result_.Reset();
+  TsmResult previous_tour;
+  previous_tour.vertices = tsm_result_.vertices;
+  completed_ants_ = 0;
+  solve_timer_.Begin();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  prepared_graph_ =
+      std::make_shared<const PreparedGraph>(*prepared_graph_, changes);
+  vertices_ = &prepared_graph_->GetGraph();
+  lower_bound_ = IsLowerBoundNeeded()
+                     ? prepared_graph_->GetLowerBound(threads_quantity_)
+                     : 0;
+  previous_tour.distance = CalculateTourDistance(previous_tour.vertices);
+  if (previous_tour.distance == INFINITY) {
+    previous_tour = TsmResult();
+  } else {
+    RepairTour(&previous_tour);
+  }
+  tsm_result_ = previous_tour;
+  mean_weight_ = prepared_graph_->GetMeanWeight();
+  SetupInitialPheromone(prepared_graph_->GetNearestNeighbourDistance());
+  UpdatePheromoneLimits();
+  ResetChangedPheromones(changes);
+  Matrix warm_pheromones = pheromones_;
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    SetupColony();
+    pheromones_ = warm_pheromones;
+    UpdateChoiceInfo();
+    solving_method();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+    if (IsCancelled()) {
+      break;
     }
-    int tmp_next = next_vertex;
-    current_vertex = next_vertex;
-    next_vertex = GetNextVertex(current_vertex, visited_vertices);
+  }
+  tsm_result_.lower_bound = lower_bound_;
+  tsm_result_.gap = CalculateGap(tsm_result_.distance, lower_bound_);
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(tsm_result_);
+}
+
+// The rows and columns of both ends of a changed edge keep
+// 1 - kChangedPheromoneReset of their trail, which lets the ants explore
+// the neighbourhood of the change without forgetting the rest of the tour
+void AntAlgorithm::ResetChangedPheromones(
+    const std::vector<EdgeChange>& changes) {
+  size_type size = vertices_->GetRows();
+  std::vector<bool> is_changed(size, false);
+  for (const EdgeChange& change : changes) {
+    is_changed[change.from] = true;
+    is_changed[change.to] = true;
+  }
+  auto reset = [this](double* pheromone) {
+    *pheromone += kChangedPheromoneReset * (initial_pheromone_ - *pheromone);
+    *pheromone = std::min(max_pheromone_, std::max(min_pheromone_, *pheromone));
+  };
+  for (size_type vertex = 0; vertex < size; ++vertex) {
+    if (!is_changed[vertex]) {
+      continue;
+    }
+    for (size_type other = 0; other < size; ++other) {
+      reset(&pheromones_(vertex, other));
+      if (!is_changed[other]) {
+        reset(&pheromones_(other, vertex));
+      }
+    }
+  }
+}
+
+// Local search moves the repriced tour away from the edges that became
+// longer before the ants start from it
+void AntAlgorithm::RepairTour(TsmResult* tour) const {
+  LocalSearch local_search;
+  local_search.Setup(vertices_, &prepared_graph_->GetCandidates(),
+                     prepared_graph_->IsSymmetric());
+  double distance = local_search.Improve(tour->vertices);
+  if (distance < tour->distance) {
+    tour->vertices = local_search.GetTour();
+    tour->distance = distance;
+  }
+}
+
+// Infinite for an empty tour or one that uses a missing edge
+double AntAlgorithm::CalculateTourDistance(const std::vector<int>& tour) const {
+  if (tour.empty()) {
+    return INFINITY;
+  }
+  double distance = 0;
+  for (size_t i = 1; i < tour.size(); ++i) {
+    if (!HasEdge(tour[i - 1], tour[i])) {
+      return INFINITY;
+    }
+    distance += (*vertices_)(tour[i - 1], tour[i]);
+  }
+  return distance;
+}
+
+// The graph of the last solve is reused while the weights and the
+// candidates quantity stay the same
+std::shared_ptr<const s21::ant::PreparedGraph> AntAlgorithm::GetPreparedGraph(
+    const Matrix& graph) {
+  if (prepared_graph_ == nullptr ||
+      !prepared_graph_->IsPreparedFor(graph, candidates_quantity_)) {
+    prepared_graph_ =
+        std::make_shared<const PreparedGraph>(graph, candidates_quantity_);
+  }
+  return prepared_graph_;
+}
+
+void AntAlgorithm::SetCandidatesQuantity(const int candidates_quantity) {
+  candidates_quantity_ = std::max(1, candidates_quantity);
+}
+
+void AntAlgorithm::Prepare(std::shared_ptr<const PreparedGraph> graph) {
+  tsm_result_ = TsmResult();
+  completed_ants_ = 0;
+  solve_timer_.Begin();
+  threads_quantity_ = 1;
+  prepared_graph_ = graph;
+  vertices_ = &prepared_graph_->GetGraph();
+  lower_bound_ = IsLowerBoundNeeded() ? prepared_graph_->GetLowerBound(1) : 0;
+  tsm_result_.lower_bound = lower_bound_;
+  Setup();
+}
+
+// Returns whether the colony has stopped
+bool AntAlgorithm::RunBatches(const int batches_quantity) {
+  for (int i = 0; i < batches_quantity && !is_stopped_; ++i) {
+    RunBatch();
+    is_stopped_ = ShouldStop();
+  }
+  return is_stopped_;
+}
+
+// A tour from another colony is deposited like the tour of an own ant and
+// becomes the best tour of the colony when it is shorter
+void AntAlgorithm::AcceptMigrant(const TsmResult& migrant) {
+  if (migrant.distance == INFINITY) {
+    return;
+  }
+  double tay = CalculateTay(migrant.distance);
+  for (size_t i = 1; i < migrant.vertices.size(); ++i) {
+    int from = migrant.vertices[i - 1], to = migrant.vertices[i];
+    pheromones_(from, to) = std::min(max_pheromone_, pheromones_(from, to) + tay);
+    pheromones_(to, from) = std::min(max_pheromone_, pheromones_(to, from) + tay);
+  }
+  if (migrant.distance < tsm_result_.distance) {
+    tsm_result_.distance = migrant.distance;
+    tsm_result_.vertices = migrant.vertices;
+  }
+  UpdateChoiceInfo();
+}
+
+const s21::ant::TsmResult& AntAlgorithm::GetBestTour() const {
+  return tsm_result_;
+}
+
+// Mean number of edges of a vertex whose pheromone is above
+// min + lambda * (max - min), where min and max are the pheromone bounds for
+// MAX-MIN Ant System and the extremes of the row otherwise. It falls to
+// about 2 when every vertex keeps only the edges of one tour
+double AntAlgorithm::CalculateBranchingFactor() {
+  branching_.assign(vertices_->GetRows(), 0);
+  ProcessRowsInParallel(std::bind(&AntAlgorithm::BranchingFactorRows, this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2));
+  double branching_factor = 0;
+  for (int branches : branching_) {
+    branching_factor += branches;
+  }
+  return branching_factor / vertices_->GetRows();
+}
+
+void AntAlgorithm::BranchingFactorRows(const size_type first_row,
+                                       const size_type last_row) {
+  size_type columns = pheromones_.GetColumns();
+  for (size_type i = first_row; i < last_row; ++i) {
+    const double* pheromones = &pheromones_(i, 0);
+    double min = min_pheromone_, max = max_pheromone_;
+    if (parameters_.variant != AntVariant::kMaxMinAntSystem) {
+      min = INFINITY;
+      max = 0;
+      for (size_type j = 0; j < columns; ++j) {
+        if (HasEdge(i, j) && i != j) {
+          min = std::min(min, pheromones[j]);
+          max = std::max(max, pheromones[j]);
+        }
+      }
+    }
+    double threshold = min + kBranchingFactorLambda * (max - min);
+    for (size_type j = 0; j < columns; ++j) {
+      branching_[i] += HasEdge(i, j) && i != j && pheromones[j] >= threshold;
+    }
+  }
+}
+
+// A dead end in an incomplete graph abandons the ant without a deposit,
+// after a cancellation the ant does not start
+void AntAlgorithm::AntPassage(const int ant_index) {
+  S21_TRACE_SCOPE("ant");
+  Ant& ant = ants_[ant_index];
+  double current_dictance = 0;
+  int current_vertex = 0, first_vertex = 0;
+  ant.Reset(vertices_->GetRows(), first_vertex);
+  if (IsCancelled()) {
+    return;
+  }
+
+  while (ant.HasUnvisited()) {
+    double distance = 0;
+    int next_vertex = GetNextVertex(current_vertex, &ant, &distance);
     if (next_vertex == kDefaultNextVertexValue) {
-      next_vertex = tmp_next;
+      ++completed_ants_;
+      return;
     }
+    ant.Visit(next_vertex);
+    current_dictance += distance;
+    current_vertex = next_vertex;
   }
 
   if (HasEdge(current_vertex, first_vertex)) {
-    visited_vertices->push_back(first_vertex);
-    current_dictance += vertices_(current_vertex, first_vertex);
+    ant.CloseTour();
+    current_dictance += (*vertices_)(current_vertex, first_vertex);
   }
 
-  SetPheromoneChanges(current_dictance, visited_vertices);
-  mtx_.lock();
-  if (current_dictance < tsm_result_.distance) {
-    tsm_result_.distance = current_dictance;
-    tsm_result_.vertices = *visited_vertices;
+  ant.SetDistance(current_dictance);
+  if (parameters_.local_search == LocalSearchMode::kEveryAnt) {
+    ImproveTour(ant_index);
   }
-  mtx_.unlock();
-  delete visited_vertices;
+  SetPheromoneChanges(ant.GetDistance(), &ant);
+  ++completed_ants_;
+  UpdateBestTour(ant);
 }
 
-void AntAlgorithm::Setup(const Matrix& graph) {
-  vertices_ = graph;
-  if (IsolatedVerticesExists()) {
-    vertices_.Clear();
-    throw s21::DisconnectedGraph();
+// Only complete closed tours are improved, returns whether the tour changed
+bool AntAlgorithm::ImproveTour(const int ant_index) {
+  S21_TRACE_SCOPE("local search");
+  Ant& ant = ants_[ant_index];
+  if (ant.GetTour().size() != vertices_->GetRows() + 1) {
+    return false;
   }
-  pheromones_.Resize(vertices_.GetRows(), vertices_.GetColumns());
-  change_in_pheromones_.Resize(vertices_.GetRows(), vertices_.GetColumns());
+  LocalSearch& local_search = local_searches_[ant_index];
+  double distance = local_search.Improve(ant.GetTour());
+  if (distance < ant.GetDistance()) {
+    ant.ReplaceTour(local_search.GetTour(), distance);
+    return true;
+  }
+  return false;
+}
+
+void AntAlgorithm::Setup() {
+  SetupColony();
+  SetupInitialPheromone(prepared_graph_->GetNearestNeighbourDistance());
+  pheromones_.Resize(vertices_->GetRows(), vertices_->GetColumns());
   for (s21::Matrix::size_type i = 0; i < pheromones_.GetRows(); ++i) {
     for (s21::Matrix::size_type j = 0; j < pheromones_.GetColumns(); ++j) {
-      pheromones_(i, j) = kDefaultPheromoneValue;
-      change_in_pheromones_(i, j) = kDefaultPheromoneChangeValue;
+      pheromones_(i, j) = initial_pheromone_;
     }
   }
+  UpdateChoiceInfo();
 }
 
-double AntAlgorithm::CalculateTay(const double current_distance) {
-  double Q = 0, tay = 0;
-  for (size_type i = 0; i < vertices_.GetRows(); i++) {
-    for (size_type j = 0; j < vertices_.GetColumns(); j++) {
-      Q += vertices_(i, j);
-    }
+// Everything of a colony but its pheromones
+void AntAlgorithm::SetupColony() {
+  SetupBatches();
+  is_stopped_ = false;
+  local_searches_.resize(kThreadsQuantity);
+  for (LocalSearch& local_search : local_searches_) {
+    local_search.Setup(vertices_, &prepared_graph_->GetCandidates(),
+                       prepared_graph_->IsSymmetric());
+  }
+  mean_weight_ = prepared_graph_->GetMeanWeight();
+  candidate_rows_.Setup(*prepared_graph_, parameters_.beta);
+  choice_info_.Resize(vertices_->GetRows(), vertices_->GetColumns());
+  if (parameters_.selection == SelectionMethod::kAliasTable) {
+    alias_tables_.Resize(vertices_->GetRows(),
+                         prepared_graph_->GetCandidatesQuantity());
   }
-  Q /= vertices_.GetRows() * vertices_.GetColumns();
-  tay = Q / current_distance;
-  return tay;
 }
 
-double AntAlgorithm::GetRandomNumber(const int min, const int max) const {
-  std::random_device dev;
-  std::mt19937 rng(dev());
-  std::uniform_int_distribution<std::mt19937::result_type> dist6(min, max);
-  return static_cast<double>(dist6(rng));
+void AntAlgorithm::UpdateChoiceInfo() {
+  S21_TRACE_SCOPE("update choice info");
+  ProcessRowsInParallel(std::bind(&AntAlgorithm::UpdateChoiceInfoRows, this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2));
 }
 
-double AntAlgorithm::GetRandomNumberFromZeroToOne() const {
-  return GetRandomNumber(0, 100) / 100.0;
+void AntAlgorithm::UpdateChoiceInfoRows(const size_type first_row,
+                                        const size_type last_row) {
+  size_type columns = choice_info_.GetColumns();
+  for (size_type i = first_row; i < last_row; ++i) {
+    const double* pheromones = &pheromones_(i, 0);
+    const double* heuristic = &prepared_graph_->GetHeuristic()(i, 0);
+    double* choice_info = &choice_info_(i, 0);
+    if (parameters_.alpha == 1 && parameters_.beta == 1) {
+      for (size_type j = 0; j < columns; ++j) {
+        choice_info[j] = pheromones[j] * heuristic[j];
+      }
+    } else {
+      for (size_type j = 0; j < columns; ++j) {
+        choice_info[j] = std::pow(pheromones[j], parameters_.alpha) *
+                         std::pow(heuristic[j], parameters_.beta);
+      }
+    }
+    candidate_rows_.UpdateChoice(i, pheromones, parameters_.alpha);
+    if (parameters_.selection == SelectionMethod::kAliasTable) {
+      alias_tables_.Build(i, candidate_rows_.GetChoice(i),
+                          candidate_rows_.GetQuantity(i));
+    }
+  }
 }
 
+// Records the deposit of the tour on the ant, the pheromones themselves are
+// only changed when the batch is merged
 void AntAlgorithm::SetPheromoneChanges(const double current_dictance,
-                                       const std::vector<int>* visited) {
+                                       Ant* ant) {
   double tay = CalculateTay(current_dictance);
-  double p = 0;
-  Matrix pheromones_tmp(pheromones_);
-  for (size_type i = 0; i < pheromones_tmp.GetRows(); i++) {
-    for (size_type j = 0; j < pheromones_tmp.GetColumns(); j++) {
-      pheromones_tmp(i, j) = (1 - p) * pheromones_tmp(i, j);
-    }
-  }
-
-  std::vector<int>::const_iterator next = visited->cbegin() + 1,
-                                   cur = visited->cbegin();
-  while (next != visited->cend()) {
-    pheromones_tmp(*cur, *next) = (1 - p) * pheromones_(*cur, *next) + tay;
-    pheromones_tmp(*next, *cur) = (1 - p) * pheromones_(*next, *cur) + tay;
+  const std::vector<int>& visited = ant->GetTour();
+  std::vector<int>::const_iterator next = visited.cbegin() + 1,
+                                   cur = visited.cbegin();
+  while (next != visited.cend()) {
+    ant->AddDeposit(*cur, *next, tay);
     cur++;
     next++;
   }
+}
+
+// The best tour of a batch goes through local search before it deposits
+void AntAlgorithm::ImproveBatchBestTour() {
+  if (parameters_.local_search != LocalSearchMode::kBatchBest ||
+      batch_best_ant_ == kDefaultNextVertexValue) {
+    return;
+  }
+  Ant& ant = ants_[batch_best_ant_];
+  if (ImproveTour(batch_best_ant_)) {
+    SetPheromoneChanges(ant.GetDistance(), &ant);
+    UpdateBestTour(ant);
+  }
+}
 
-  for (size_type i = 0; i < pheromones_tmp.GetRows(); i++) {
-    for (size_type j = 0; j < pheromones_tmp.GetColumns(); j++) {
-      change_in_pheromones_(i, j) += pheromones_tmp(i, j) - pheromones_(i, j);
+void AntAlgorithm::EvaporateRows(const size_type first_row,
+                                 const size_type last_row,
+                                 const double evaporation) {
+  if (evaporation == 0) {
+    return;
+  }
+  size_type columns = pheromones_.GetColumns();
+  for (size_type i = first_row; i < last_row; ++i) {
+    double* pheromones = &pheromones_(i, 0);
+    for (size_type j = 0; j < columns; ++j) {
+      pheromones[j] *= 1 - evaporation;
     }
   }
 }
 
-void AntAlgorithm::AddPheromoneChange() {
-  for (int i = 0; i < change_in_pheromones_.GetRows(); ++i) {
-    for (int j = 0; j < change_in_pheromones_.GetColumns(); ++j) {
-      pheromones_(i, j) += change_in_pheromones_(i, j);
-      change_in_pheromones_(i, j) = kDefaultPheromoneChangeValue;
+void AntAlgorithm::ApplyDepositsRows(const size_type first_row,
+                                     const size_type last_row,
+                                     const Ant& ant) {
+  for (const Deposit& deposit : ant.GetDeposits()) {
+    if (deposit.from >= first_row && deposit.from < last_row) {
+      pheromones_(deposit.from, deposit.to) += deposit.delta;
     }
+    if (deposit.to >= first_row && deposit.to < last_row) {
+      pheromones_(deposit.to, deposit.from) += deposit.delta;
+    }
+  }
+}
+
+void AntAlgorithm::AntSystemRows(const size_type first_row,
+                                 const size_type last_row) {
+  EvaporateRows(first_row, last_row, parameters_.evaporation);
+  for (const Ant& ant : ants_) {
+    ApplyDepositsRows(first_row, last_row, ant);
   }
 }
 
-double AntAlgorithm::CalculateAllPossibleWaysCost(
-    const int current_vertex, const std::vector<int>* visited) {
-  double cost = 0;
-  for (int i = 0; i < vertices_.GetRows(); ++i) {
-    if (vertices_(current_vertex, i) != kDefaultCost &&
-        WasNotVisited(i, visited)) {
-      cost +=
-          (1 / vertices_(current_vertex, i)) * pheromones_(current_vertex, i);
+void AntAlgorithm::MaxMinAntSystemRows(const size_type first_row,
+                                       const size_type last_row) {
+  EvaporateRows(first_row, last_row, parameters_.evaporation);
+  if (batch_best_ant_ != kDefaultNextVertexValue) {
+    ApplyDepositsRows(first_row, last_row, ants_[batch_best_ant_]);
+  }
+  size_type columns = pheromones_.GetColumns();
+  for (size_type i = first_row; i < last_row; ++i) {
+    double* pheromones = &pheromones_(i, 0);
+    for (size_type j = 0; j < columns; ++j) {
+      pheromones[j] =
+          std::min(max_pheromone_, std::max(min_pheromone_, pheromones[j]));
     }
   }
-  return cost;
 }
 
-int AntAlgorithm::GetNextVertex(const int current_vertex,
-                                const std::vector<int>* visited) {
-  double denominator = CalculateAllPossibleWaysCost(current_vertex, visited);
-  double random_number = GetRandomNumberFromZeroToOne(), p_ij = 0,
-         p_ij_prev = 0;
-  int next_vertex = 0;
-  for (int i = 0; i < vertices_.GetRows(); ++i) {
-    if (vertices_(current_vertex, i) != kDefaultCost &&
-        WasNotVisited(i, visited)) {
-      p_ij_prev = p_ij;
-      p_ij += ((1 / vertices_(current_vertex, i)) *
-               pheromones_(current_vertex, i)) /
-              denominator;
-      if (random_number > p_ij_prev && random_number <= p_ij) {
-        next_vertex = i;
-      }
+// The local updates are applied at the end of a batch instead of after every
+// step, so ants of one batch do not see the edges walked by each other
+void AntAlgorithm::AntColonySystemRows(const size_type first_row,
+                                       const size_type last_row) {
+  double xi = parameters_.local_evaporation, rho = parameters_.evaporation;
+  auto update = [this, first_row, last_row](int from, int to, double rate,
+                                            double value) {
+    if (from >= first_row && from < last_row) {
+      pheromones_(from, to) += rate * (value - pheromones_(from, to));
     }
+    if (to >= first_row && to < last_row) {
+      pheromones_(to, from) += rate * (value - pheromones_(to, from));
+    }
+  };
+  for (const Ant& ant : ants_) {
+    const std::vector<int>& tour = ant.GetTour();
+    for (size_t i = 1; i < tour.size(); ++i) {
+      update(tour[i - 1], tour[i], xi, initial_pheromone_);
+    }
+  }
+  if (tsm_result_.distance == INFINITY) {
+    return;
+  }
+  double tay = CalculateTay(tsm_result_.distance);
+  const std::vector<int>& best_tour = tsm_result_.vertices;
+  for (size_t i = 1; i < best_tour.size(); ++i) {
+    update(best_tour[i - 1], best_tour[i], rho, tay);
+  }
+}
+
+// Samples among the unvisited nearest neighbours first and scans every
+// unvisited vertex only when all of them are visited. With alias tables the
+// candidates are drawn from the table of the row, a visited draw is
+// rejected and after kAliasAttempts rejections the roulette takes over.
+// A candidate is picked by its position in the block of the row, which
+// also holds the distance of the edge. The colony system decides once per
+// step whether it exploits, with probability q0, whichever way the vertex
+// is then found
+int AntAlgorithm::GetNextVertex(const int current_vertex, Ant* ant,
+                                double* distance) const {
+  bool is_exploiting = parameters_.variant == AntVariant::kAntColonySystem &&
+                       ant->GetRandomNumber() < parameters_.exploitation;
+  int position = kDefaultNextVertexValue;
+  if (parameters_.selection == SelectionMethod::kAliasTable &&
+      !is_exploiting) {
+    position = SampleAliasTable(current_vertex, ant);
+  }
+  if (position == kDefaultNextVertexValue) {
+    position = SelectCandidate(current_vertex, is_exploiting, ant);
+  }
+  if (position != kDefaultNextVertexValue) {
+    *distance = candidate_rows_.GetDistances(current_vertex)[position];
+    return candidate_rows_.GetVertices(current_vertex)[position];
+  }
+  int next_vertex = SelectVertex(current_vertex, ant->GetUnvisited(),
+                                 is_exploiting, ant);
+  if (next_vertex != kDefaultNextVertexValue) {
+    *distance = (*vertices_)(current_vertex, next_vertex);
   }
   return next_vertex;
 }
 
-bool AntAlgorithm::HasEdge(const int lhs, const int rhs) const {
-  return vertices_(lhs, rhs) != kDefaultCost;
+// One sweep over the weights and the vertices of the block of the row
+int AntAlgorithm::SelectCandidate(const int current_vertex,
+                                  const bool is_exploiting, Ant* ant) const {
+  Roulette& roulette = ant->GetRoulette();
+  roulette.GatherByPosition(candidate_rows_.GetChoice(current_vertex),
+                            candidate_rows_.GetVertices(current_vertex),
+                            candidate_rows_.GetQuantity(current_vertex),
+                            ant->GetVisited());
+  if (roulette.IsEmpty()) {
+    return kDefaultNextVertexValue;
+  }
+  if (is_exploiting) {
+    return roulette.GetBestPosition();
+  }
+  return roulette.SelectPosition(ant->GetRandomNumber());
 }
 
-bool AntAlgorithm::IsolatedVerticesExists() const {
-  for (Matrix::size_type vertex = 0; vertex < vertices_.GetRows(); ++vertex) {
-    if (IsIsolated(vertex)) {
-      return true;
-    }
+// An exploiting step of the colony system takes the best vertex instead of
+// the roulette
+int AntAlgorithm::SelectVertex(const int current_vertex,
+                               const std::vector<int>& vertices,
+                               const bool is_exploiting, Ant* ant) const {
+  Roulette& roulette = ant->GetRoulette();
+  roulette.GatherByVertex(&choice_info_(current_vertex, 0), vertices.data(),
+                          vertices.size(), ant->GetVisited());
+  if (roulette.IsEmpty()) {
+    return kDefaultNextVertexValue;
   }
-  return false;
+  if (is_exploiting) {
+    return roulette.GetBest();
+  }
+  return roulette.Select(ant->GetRandomNumber());
 }
 
-bool AntAlgorithm::IsIsolated(const int vertex_number) const {
-  bool is_isolated = true;
-  for (Matrix::size_type vertex = 0; vertex < vertices_.GetRows(); ++vertex) {
-    if (HasEdge(vertex_number, vertex) &&
-        static_cast<Matrix::size_type>(vertex_number) != vertex) {
-      is_isolated = false;
+int AntAlgorithm::SampleAliasTable(const int current_vertex, Ant* ant) const {
+  const int* candidates = candidate_rows_.GetVertices(current_vertex);
+  const double* choice = candidate_rows_.GetChoice(current_vertex);
+  for (int attempt = 0; attempt < kAliasAttempts; ++attempt) {
+    int position = alias_tables_.Sample(current_vertex, ant->GetRandomNumber());
+    if (position == kDefaultNextVertexValue) {
+      break;
     }
-  }
-  for (Matrix::size_type vertex = 0; vertex < vertices_.GetColumns();
-       ++vertex) {
-    if (HasEdge(vertex, vertex_number) &&
-        static_cast<Matrix::size_type>(vertex_number) != vertex) {
-      is_isolated = false;
+    if (!ant->IsVisited(candidates[position]) && choice[position] > 0) {
+      return position;
     }
   }
-  return is_isolated;
+  return kDefaultNextVertexValue;
+}
+
+typename AntAlgorithm::size_type AntAlgorithm::GetSize() const {
+  return vertices_->GetRows();
 }
 
-bool AntAlgorithm::WasNotVisited(const int vertex_number,
-                                 const std::vector<int>* visited) const {
-  return std::find(visited->cbegin(), visited->cend(), vertex_number) ==
-         visited->cend();
+bool AntAlgorithm::HasEdge(const int lhs, const int rhs) const {
+  return (*vertices_)(lhs, rhs) != kDefaultCost;
 }
@@ -5,75 +5,107 @@
 #include <chrono>
 #include <ctime>
 #include <functional>
-#include <mutex>
-#include <random>
+#include <memory>
 #include <thread>
 #include <vector>
 
-#include "../algorithm_result/algorithm_result.h"
 #include "../matrix.h"
-#include "../timer/timer.h"
+#include "candidate_rows.h"
+#include "colony.h"
+#include "local_search.h"
+#include "prepared_graph.h"
+#include "roulette.h"
 
 namespace s21 {
 
 namespace ant {
 
-constexpr int kIterationsQuantity = 24000;
-constexpr int kDefaultPheromoneValue = 1;
-constexpr int kDefaultPheromoneChangeValue = 0;
-constexpr int kDefaultNextVertexValue = 0;
-constexpr int kDefaultCost = 0;
-constexpr int kThreadsQuantity = 8;
+constexpr double kChangedPheromoneReset = 0.5;  // share moved back to tau0
 
-struct TsmResult {
-  std::vector<int> vertices;
-  double distance{INFINITY};
-};
-
-class AntAlgorithm {
+// The colony of a graph given as a dense matrix, with a pheromone and a
+// choice info for every edge
+class AntAlgorithm : public Colony {
  public:
-  using size_type = Matrix::size_type;
-  using solution_type = TsmResult;
-  using result_type = AlgorithmResult<solution_type>;
+  AntAlgorithm() = default;
 
- public:
   result_type SolveTravelingSalesmanProblemSequently(
       const Matrix& graph, const int iterations_quantity);
   result_type SolveTravelingSalesmanProblemInParallel(
       const Matrix& graph, const int iterations_quantity);
+  result_type SolveTravelingSalesmanProblemSequently(
+      std::shared_ptr<const PreparedGraph> graph,
+      const int iterations_quantity);
+  result_type SolveTravelingSalesmanProblemInParallel(
+      std::shared_ptr<const PreparedGraph> graph,
+      const int iterations_quantity);
+  result_type ReoptimizeTravelingSalesmanProblemSequently(
+      const std::vector<EdgeChange>& changes, const int iterations_quantity);
+  result_type ReoptimizeTravelingSalesmanProblemInParallel(
+      const std::vector<EdgeChange>& changes, const int iterations_quantity);
+  void SetCandidatesQuantity(const int candidates_quantity);
+
+  // Steps of a single threaded colony, used by the island model
+  void Prepare(std::shared_ptr<const PreparedGraph> graph);
+  bool RunBatches(const int batches_quantity);
+  void AcceptMigrant(const TsmResult& migrant);
+  const TsmResult& GetBestTour() const;
 
  private:
-  TsmResult tsm_result_;
-  result_type result_;
   Matrix pheromones_;
-  Matrix change_in_pheromones_;
-  std::mutex mtx_;
-  s21::Matrix vertices_;
+  Matrix choice_info_;  // pheromone^alpha * heuristic^beta
+  CandidateRows candidate_rows_;  // the candidate edges of choice_info_
+  AliasTables alias_tables_;  // of candidate_rows_
+  std::shared_ptr<const PreparedGraph> prepared_graph_;
+  const Matrix* vertices_ = nullptr;  // the graph of prepared_graph_
+  int candidates_quantity_ = kDefaultCandidatesQuantity;
+  std::vector<LocalSearch> local_searches_;  // one per ant of a batch
+  bool is_stopped_ = false;
+  std::vector<int> branching_;  // branching factor per vertex
 
  private:
-  void Solve(const Matrix& graph, std::function<void()> solving_method,
+  void Solve(std::shared_ptr<const PreparedGraph> graph,
+             std::function<void()> solving_method,
              const int iterations_quantity);
-  void SolveSequently();
-  void SolveInParallel();
-
-  void Setup(const Matrix& graph);
-  void AddPheromoneChange();
-  bool WasNotVisited(const int vertex_number,
-                     const std::vector<int>* visited) const;
-  double GetRandomNumberFromZeroToOne() const;
-  double GetRandomNumber(int min, int max) const;
-  double CalculateAllPossibleWaysCost(const int current_vertex,
-                                      const std::vector<int>* visited_);
-  int GetNextVertex(const int current_vertex, const std::vector<int>* visited);
-  double CalculateTay(const double current_distance);
-
-  void SetPheromoneChanges(const double current_distance,
-                           const std::vector<int>* visited);
-  void AntPassage();
+  std::shared_ptr<const PreparedGraph> GetPreparedGraph(const Matrix& graph);
+  void Reoptimize(const std::vector<EdgeChange>& changes,
+                  std::function<void()> solving_method,
+                  const int iterations_quantity);
+  void ResetChangedPheromones(const std::vector<EdgeChange>& changes);
+  void RepairTour(TsmResult* tour) const;
+  double CalculateTourDistance(const std::vector<int>& tour) const;
+  double CalculateBranchingFactor() override;
+  void BranchingFactorRows(const size_type first_row, const size_type last_row);
+
+  void Setup();
+  void SetupColony();
+  void UpdateChoiceInfo();
+  void UpdateChoiceInfoRows(const size_type first_row,
+                            const size_type last_row) override;
+  void EvaporateRows(const size_type first_row, const size_type last_row,
+                     const double evaporation);
+  void ApplyDepositsRows(const size_type first_row, const size_type last_row,
+                         const Ant& ant);
+  void AntSystemRows(const size_type first_row,
+                     const size_type last_row) override;
+  void MaxMinAntSystemRows(const size_type first_row,
+                           const size_type last_row) override;
+  void AntColonySystemRows(const size_type first_row,
+                           const size_type last_row) override;
+  int GetNextVertex(const int current_vertex, Ant* ant,
+                    double* distance) const;
+  int SelectCandidate(const int current_vertex, const bool is_exploiting,
+                      Ant* ant) const;
+  int SelectVertex(const int current_vertex, const std::vector<int>& vertices,
+                   const bool is_exploiting, Ant* ant) const;
+  int SampleAliasTable(const int current_vertex, Ant* ant) const;
+
+  void SetPheromoneChanges(const double current_distance, Ant* ant);
+  bool ImproveTour(const int ant_index);
+  void ImproveBatchBestTour() override;
+  void AntPassage(const int ant_index) override;
+  size_type GetSize() const override;
 
   bool HasEdge(const int lhs, const int rhs) const;
-  bool IsIsolated(const int vertex_number) const;
-  bool IsolatedVerticesExists() const;
 };
 
 }  // namespace ant
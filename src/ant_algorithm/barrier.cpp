@@ -0,0 +1,35 @@
+#include "barrier.h"
+
+using s21::ant::Barrier;
+
+// Constructors
+Barrier::Barrier(const int threads_quantity)
+    : threads_quantity_(threads_quantity) {}
+
+// Methods
+
+// The last thread to arrive resets the count before it opens the next
+// generation, so a thread that passes may wait on the barrier again at once
+void Barrier::Wait() {
+  int generation = generation_.load(std::memory_order_acquire);
+  if (waiting_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+      threads_quantity_) {
+    waiting_.store(0, std::memory_order_relaxed);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      generation_.fetch_add(1, std::memory_order_release);
+    }
+    condition_.notify_all();
+    return;
+  }
+  for (int spin = 0; spin < kBarrierSpins; ++spin) {
+    if (generation_.load(std::memory_order_acquire) != generation) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this, generation]() {
+    return generation_.load(std::memory_order_acquire) != generation;
+  });
+}
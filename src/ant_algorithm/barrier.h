@@ -0,0 +1,41 @@
+#ifndef ANT_ALGORITHM_BARRIER_H_
+#define ANT_ALGORITHM_BARRIER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kBarrierSpins = 256;  // yields before a waiter goes to sleep
+
+// Holds threads_quantity threads until all of them have arrived and can be
+// passed again right away. A waiter first yields, which is enough for the
+// short phases of a parallel scan, and sleeps only when the others are far
+// behind, as the colonies of an island model are
+class Barrier {
+ public:
+  // Constructors
+  explicit Barrier(const int threads_quantity);
+  Barrier(const Barrier& other) = delete;
+  Barrier& operator=(const Barrier& other) = delete;
+
+  // Methods
+  void Wait();
+
+ private:
+  const int threads_quantity_;
+  std::atomic<int> waiting_{0};
+  std::atomic<int> generation_{0};
+  std::mutex mutex_;
+  std::condition_variable condition_;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_BARRIER_H_
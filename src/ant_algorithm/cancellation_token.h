@@ -0,0 +1,30 @@
+#ifndef ANT_ALGORITHM_CANCELLATION_TOKEN_H_
+#define ANT_ALGORITHM_CANCELLATION_TOKEN_H_
+
+#include <atomic>
+
+namespace s21 {
+
+namespace ant {
+
+// Shared between the caller and a running solver. The solver checks it
+// before every ant, so Cancel may be called from any thread, including an
+// improvement callback
+class CancellationToken {
+ public:
+  // Methods
+  void Cancel() { is_cancelled_.store(true, std::memory_order_relaxed); }
+  void Reset() { is_cancelled_.store(false, std::memory_order_relaxed); }
+  bool IsCancelled() const {
+    return is_cancelled_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool> is_cancelled_{false};
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_CANCELLATION_TOKEN_H_
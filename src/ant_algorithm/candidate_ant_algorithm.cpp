@@ -0,0 +1,338 @@
+#include "candidate_ant_algorithm.h"
+
+using s21::ant::CandidateAntAlgorithm;
+
+typename CandidateAntAlgorithm::result_type
+CandidateAntAlgorithm::SolveTravelingSalesmanProblemSequently(
+    const GeometricInstance& instance, const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&CandidateAntAlgorithm::SolveSequently, this);
+  threads_quantity_ = 1;
+  Solve(instance, solving_method, iterations_quantity);
+  return result_;
+}
+
+typename CandidateAntAlgorithm::result_type
+CandidateAntAlgorithm::SolveTravelingSalesmanProblemInParallel(
+    const GeometricInstance& instance, const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&CandidateAntAlgorithm::SolveInParallel, this);
+  threads_quantity_ = kThreadsQuantity;
+  Solve(instance, solving_method, iterations_quantity);
+  return result_;
+}
+
+void CandidateAntAlgorithm::SetCandidatesQuantity(
+    const int candidates_quantity) {
+  candidates_quantity_ = std::max(1, candidates_quantity);
+}
+
+void CandidateAntAlgorithm::Solve(const GeometricInstance& instance,
+                                  std::function<void()> solving_method,
+                                  const int iterations_quantity) {
+  result_.Reset();
+  tsm_result_ = TsmResult();
+  completed_ants_ = 0;
+  solve_timer_.Begin();
+  instance_ = &instance;
+  size_ = instance.GetSize();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  SetupCandidates();
+  lower_bound_ = IsLowerBoundNeeded()
+                     ? OneTreeBound().Calculate(*instance_,
+                                                nearest_neighbour_distance_,
+                                                threads_quantity_)
+                     : 0;
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    Setup();
+    solving_method();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+    if (IsCancelled()) {
+      break;
+    }
+  }
+  tsm_result_.lower_bound = lower_bound_;
+  tsm_result_.gap = CalculateGap(tsm_result_.distance, lower_bound_);
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(tsm_result_);
+}
+
+// Candidate lists and their distances do not change between iterations, nor
+// does the nearest neighbour tour along them. The mean weight is estimated
+// from a fixed sample of city pairs
+void CandidateAntAlgorithm::SetupCandidates() {
+  row_length_ = std::min(candidates_quantity_, size_ - 1);
+  candidates_ = instance_->FindNearestNeighbours(row_length_);
+  int64_t entries = int64_t{size_} * row_length_;
+  distances_.resize(entries);
+  heuristic_.resize(entries);
+  for (size_type i = 0; i < size_; ++i) {
+    int64_t row = int64_t{i} * row_length_;
+    instance_->Distances(i, &candidates_[row], row_length_,
+                         &distances_[row]);
+  }
+  for (int64_t i = 0; i < entries; ++i) {
+    double distance = std::max(distances_[i], kMinimumGeometricDistance);
+    heuristic_[i] = std::pow(1 / distance, parameters_.beta);
+  }
+  std::mt19937 rng(size_);
+  std::uniform_int_distribution<size_type> city(0, size_ - 1);
+  mean_weight_ = 0;
+  for (size_type i = 0; i < size_; ++i) {
+    mean_weight_ += instance_->Distance(city(rng), city(rng));
+  }
+  mean_weight_ = std::max(mean_weight_ / size_, kMinimumGeometricDistance);
+  ants_.resize(kThreadsQuantity);
+  fallback_distances_.resize(kThreadsQuantity);
+  nearest_neighbour_distance_ = CalculateNearestNeighbourDistance();
+}
+
+void CandidateAntAlgorithm::Setup() {
+  SetupBatches();
+  SetupInitialPheromone(nearest_neighbour_distance_);
+  int64_t entries = int64_t{size_} * row_length_;
+  pheromones_.assign(entries, initial_pheromone_);
+  choice_info_.resize(entries);
+  if (parameters_.selection == SelectionMethod::kAliasTable) {
+    alias_tables_.Resize(size_, row_length_);
+  }
+  ProcessRowsInParallel(std::bind(&CandidateAntAlgorithm::UpdateChoiceInfoRows,
+                                  this, std::placeholders::_1,
+                                  std::placeholders::_2));
+}
+
+double CandidateAntAlgorithm::CalculateNearestNeighbourDistance() {
+  Ant& ant = ants_[0];
+  ant.Reset(size_, 0);
+  int current_vertex = 0;
+  double distance = 0;
+  while (ant.HasUnvisited()) {
+    int next_vertex = kDefaultNextVertexValue;
+    const size_type* candidates =
+        &candidates_[int64_t{current_vertex} * row_length_];
+    for (size_type i = 0; i < row_length_; ++i) {
+      if (!ant.IsVisited(candidates[i])) {
+        next_vertex = candidates[i];
+        break;
+      }
+    }
+    if (next_vertex == kDefaultNextVertexValue) {
+      next_vertex = FindNearestUnvisited(current_vertex, 0);
+    }
+    ant.Visit(next_vertex);
+    distance += instance_->Distance(current_vertex, next_vertex);
+    current_vertex = next_vertex;
+  }
+  distance += instance_->Distance(current_vertex, 0);
+  return std::max(distance, kMinimumGeometricDistance);
+}
+
+// The heuristic already holds (1 / distance)^beta
+void CandidateAntAlgorithm::UpdateChoiceInfoRows(const size_type first_row,
+                                                 const size_type last_row) {
+  int64_t first = int64_t{first_row} * row_length_;
+  int64_t last = int64_t{last_row} * row_length_;
+  if (parameters_.alpha == 1) {
+    for (int64_t i = first; i < last; ++i) {
+      choice_info_[i] = pheromones_[i] * heuristic_[i];
+    }
+  } else {
+    for (int64_t i = first; i < last; ++i) {
+      choice_info_[i] = std::pow(pheromones_[i], parameters_.alpha) *
+                        heuristic_[i];
+    }
+  }
+  if (parameters_.selection == SelectionMethod::kAliasTable) {
+    for (size_type i = first_row; i < last_row; ++i) {
+      alias_tables_.Build(i, &choice_info_[int64_t{i} * row_length_],
+                          row_length_);
+    }
+  }
+}
+
+void CandidateAntAlgorithm::AntPassage(const int ant_index) {
+  S21_TRACE_SCOPE("ant");
+  Ant& ant = ants_[ant_index];
+  double current_distance = 0;
+  int current_vertex = 0, first_vertex = 0;
+  ant.Reset(size_, first_vertex);
+  if (IsCancelled()) {
+    return;
+  }
+  while (ant.HasUnvisited()) {
+    int next_vertex = GetNextVertex(current_vertex, ant_index);
+    ant.Visit(next_vertex);
+    current_distance += instance_->Distance(current_vertex, next_vertex);
+    current_vertex = next_vertex;
+  }
+  ant.CloseTour();
+  current_distance += instance_->Distance(current_vertex, first_vertex);
+  ant.SetDistance(current_distance);
+  ++completed_ants_;
+  UpdateBestTour(ant);
+}
+
+// Roulette over the unvisited candidates, or the best of them with
+// probability q0 in the colony system. Alias tables are tried first and
+// give way to the roulette after kAliasAttempts visited draws
+int CandidateAntAlgorithm::GetNextVertex(const int current_vertex,
+                                         const int ant_index) {
+  Ant& ant = ants_[ant_index];
+  int64_t row = int64_t{current_vertex} * row_length_;
+  const size_type* candidates = &candidates_[row];
+  const double* choice_info = &choice_info_[row];
+  bool is_exploiting = parameters_.variant == AntVariant::kAntColonySystem &&
+                       ant.GetRandomNumber() < parameters_.exploitation;
+  if (parameters_.selection == SelectionMethod::kAliasTable &&
+      !is_exploiting) {
+    for (int attempt = 0; attempt < kAliasAttempts; ++attempt) {
+      int position = alias_tables_.Sample(current_vertex,
+                                          ant.GetRandomNumber());
+      if (position == kDefaultNextVertexValue) {
+        break;
+      }
+      if (!ant.IsVisited(candidates[position]) && choice_info[position] > 0) {
+        return candidates[position];
+      }
+    }
+  }
+  Roulette& roulette = ant.GetRoulette();
+  roulette.GatherByPosition(choice_info, candidates, row_length_,
+                            ant.GetVisited());
+  if (roulette.IsEmpty()) {
+    return FindNearestUnvisited(current_vertex, ant_index);
+  }
+  if (is_exploiting) {
+    return roulette.GetBest();
+  }
+  return roulette.Select(ant.GetRandomNumber());
+}
+
+int CandidateAntAlgorithm::FindNearestUnvisited(const int current_vertex,
+                                                const int ant_index) {
+  const std::vector<size_type>& unvisited = ants_[ant_index].GetUnvisited();
+  std::vector<double>& distances = fallback_distances_[ant_index];
+  distances.resize(unvisited.size());
+  instance_->Distances(current_vertex, unvisited.data(), unvisited.size(),
+                       distances.data());
+  return unvisited[std::min_element(distances.begin(), distances.end()) -
+                   distances.begin()];
+}
+
+typename CandidateAntAlgorithm::size_type CandidateAntAlgorithm::FindCandidate(
+    const size_type from, const size_type to) const {
+  const size_type* candidates =
+      &candidates_[int64_t{from} * row_length_];
+  for (size_type i = 0; i < row_length_; ++i) {
+    if (candidates[i] == to) {
+      return i;
+    }
+  }
+  return kDefaultNextVertexValue;
+}
+
+void CandidateAntAlgorithm::EvaporateRows(const size_type first_row,
+                                          const size_type last_row) {
+  if (parameters_.evaporation == 0) {
+    return;
+  }
+  int64_t first = int64_t{first_row} * row_length_;
+  int64_t last = int64_t{last_row} * row_length_;
+  for (int64_t i = first; i < last; ++i) {
+    pheromones_[i] *= 1 - parameters_.evaporation;
+  }
+}
+
+// Adds value to the trail of every candidate edge of the tour, or moves the
+// trail towards value by rate when is_blended
+void CandidateAntAlgorithm::DepositRows(const size_type first_row,
+                                        const size_type last_row,
+                                        const std::vector<int>& tour,
+                                        const double rate, const double value,
+                                        const bool is_blended) {
+  auto deposit = [&](size_type from, size_type to) {
+    if (from < first_row || from >= last_row) return;
+    size_type candidate = FindCandidate(from, to);
+    if (candidate == kDefaultNextVertexValue) return;
+    double& pheromone =
+        pheromones_[int64_t{from} * row_length_ + candidate];
+    pheromone += is_blended ? rate * (value - pheromone) : value;
+  };
+  for (size_t i = 1; i < tour.size(); ++i) {
+    deposit(tour[i - 1], tour[i]);
+    deposit(tour[i], tour[i - 1]);
+  }
+}
+
+void CandidateAntAlgorithm::AntSystemRows(const size_type first_row,
+                                          const size_type last_row) {
+  EvaporateRows(first_row, last_row);
+  for (const Ant& ant : ants_) {
+    DepositRows(first_row, last_row, ant.GetTour(), 0,
+                CalculateTay(ant.GetDistance()), false);
+  }
+}
+
+void CandidateAntAlgorithm::MaxMinAntSystemRows(const size_type first_row,
+                                                const size_type last_row) {
+  EvaporateRows(first_row, last_row);
+  if (batch_best_ant_ != kDefaultNextVertexValue) {
+    const Ant& ant = ants_[batch_best_ant_];
+    DepositRows(first_row, last_row, ant.GetTour(), 0,
+                CalculateTay(ant.GetDistance()), false);
+  }
+  int64_t first = int64_t{first_row} * row_length_;
+  int64_t last = int64_t{last_row} * row_length_;
+  for (int64_t i = first; i < last; ++i) {
+    pheromones_[i] =
+        std::min(max_pheromone_, std::max(min_pheromone_, pheromones_[i]));
+  }
+}
+
+void CandidateAntAlgorithm::AntColonySystemRows(const size_type first_row,
+                                                const size_type last_row) {
+  for (const Ant& ant : ants_) {
+    DepositRows(first_row, last_row, ant.GetTour(),
+                parameters_.local_evaporation, initial_pheromone_, true);
+  }
+  if (tsm_result_.distance == INFINITY) {
+    return;
+  }
+  DepositRows(first_row, last_row, tsm_result_.vertices,
+              parameters_.evaporation, CalculateTay(tsm_result_.distance),
+              true);
+}
+
+// Counted over the candidate edges only
+double CandidateAntAlgorithm::CalculateBranchingFactor() {
+  int64_t branches = 0;
+  for (size_type i = 0; i < size_; ++i) {
+    const double* pheromones = &pheromones_[int64_t{i} * row_length_];
+    double min = min_pheromone_, max = max_pheromone_;
+    if (parameters_.variant != AntVariant::kMaxMinAntSystem) {
+      min = *std::min_element(pheromones, pheromones + row_length_);
+      max = *std::max_element(pheromones, pheromones + row_length_);
+    }
+    double threshold = min + kBranchingFactorLambda * (max - min);
+    for (size_type j = 0; j < row_length_; ++j) {
+      branches += pheromones[j] >= threshold;
+    }
+  }
+  return static_cast<double>(branches) / size_;
+}
+
+typename CandidateAntAlgorithm::size_type CandidateAntAlgorithm::GetSize()
+    const {
+  return size_;
+}
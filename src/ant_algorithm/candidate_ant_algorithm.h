@@ -0,0 +1,83 @@
+#ifndef ANT_ALGORITHM_CANDIDATE_ANT_ALGORITHM_H_
+#define ANT_ALGORITHM_CANDIDATE_ANT_ALGORITHM_H_
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "colony.h"
+#include "geometric_instance.h"
+#include "one_tree_bound.h"
+#include "prepared_graph.h"
+#include "roulette.h"
+
+namespace s21 {
+
+namespace ant {
+
+// The ant colony of AntAlgorithm for instances too large for a dense
+// matrix. Pheromones, heuristic and choice info are kept only for the
+// candidate edges, n * candidates_quantity entries, and distances come from
+// the coordinates. An ant whose candidates are all visited moves to the
+// nearest unvisited city, every edge outside the lists has the same trail.
+// The colony works in batches of kThreadsQuantity ants with the variants
+// and stopping criteria of AntParameters; local search is not applied. The
+// lower bound of a solve ascends on the nearest neighbour graph and takes
+// a single dense 1-tree at the end.
+class CandidateAntAlgorithm : public Colony {
+ public:
+  CandidateAntAlgorithm() = default;
+
+  result_type SolveTravelingSalesmanProblemSequently(
+      const GeometricInstance& instance, const int iterations_quantity);
+  result_type SolveTravelingSalesmanProblemInParallel(
+      const GeometricInstance& instance, const int iterations_quantity);
+  void SetCandidatesQuantity(const int candidates_quantity);
+
+ private:
+  const GeometricInstance* instance_ = nullptr;
+  size_type size_ = 0;
+  size_type candidates_quantity_ = kDefaultCandidatesQuantity;
+  size_type row_length_ = 0;  // candidates per city for this instance
+  std::vector<size_type> candidates_;  // row of candidates per city
+  std::vector<double> distances_;      // of the candidate edges
+  std::vector<double> heuristic_;
+  std::vector<double> pheromones_;
+  std::vector<double> choice_info_;
+  AliasTables alias_tables_;  // of the rows of choice_info_
+  std::vector<std::vector<double>> fallback_distances_;  // one per ant
+  double nearest_neighbour_distance_ = 0;  // of the tour along candidates
+
+ private:
+  void Solve(const GeometricInstance& instance,
+             std::function<void()> solving_method,
+             const int iterations_quantity);
+  void SetupCandidates();
+  void Setup();
+  double CalculateNearestNeighbourDistance();
+  void UpdateChoiceInfoRows(const size_type first_row,
+                            const size_type last_row) override;
+  void AntPassage(const int ant_index) override;
+  int GetNextVertex(const int current_vertex, const int ant_index);
+  int FindNearestUnvisited(const int current_vertex, const int ant_index);
+  size_type FindCandidate(const size_type from, const size_type to) const;
+  void EvaporateRows(const size_type first_row, const size_type last_row);
+  void DepositRows(const size_type first_row, const size_type last_row,
+                   const std::vector<int>& tour, const double rate,
+                   const double value, const bool is_blended);
+  void AntSystemRows(const size_type first_row,
+                     const size_type last_row) override;
+  void MaxMinAntSystemRows(const size_type first_row,
+                           const size_type last_row) override;
+  void AntColonySystemRows(const size_type first_row,
+                           const size_type last_row) override;
+  double CalculateBranchingFactor() override;
+  size_type GetSize() const override;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_CANDIDATE_ANT_ALGORITHM_H_
@@ -0,0 +1,83 @@
+#include "candidate_rows.h"
+
+using s21::ant::CandidateRows;
+
+// Methods
+
+// The block of a row is laid out as choice, heuristic, distances and
+// vertices. A vertex with fewer neighbours than the candidates quantity
+// leaves the rest of its arrays zero
+void CandidateRows::Setup(const PreparedGraph& graph, const double beta) {
+  const std::vector<std::vector<int>>& candidates = graph.GetCandidates();
+  size_type size = graph.GetSize();
+  padded_quantity_ = (graph.GetCandidatesQuantity() + kRowPadding - 1) /
+                     kRowPadding * kRowPadding;
+  int64_t row_bytes =
+      padded_quantity_ * (kVerticesArray * sizeof(double) + sizeof(int));
+  row_lines_ = (row_bytes + kCacheLineSize - 1) / kCacheLineSize;
+  lines_.assign(size * row_lines_, CacheLine());
+  quantities_.resize(size);
+  for (size_type row = 0; row < size; ++row) {
+    const std::vector<int>& neighbours = candidates[row];
+    quantities_[row] = neighbours.size();
+    double* heuristic = GetArray(row, kHeuristicArray);
+    double* distances = GetArray(row, kDistancesArray);
+    int* vertices = reinterpret_cast<int*>(GetArray(row, kVerticesArray));
+    for (size_t i = 0; i < neighbours.size(); ++i) {
+      vertices[i] = neighbours[i];
+      distances[i] = graph.GetGraph()(row, neighbours[i]);
+      heuristic[i] = std::pow(graph.GetHeuristic()(row, neighbours[i]), beta);
+    }
+  }
+}
+
+// The pheromones are a full row of the colony, read at the candidates
+void CandidateRows::UpdateChoice(const size_type row, const double* pheromones,
+                                 const double alpha) {
+  double* choice = GetArray(row, kChoiceArray);
+  const double* heuristic = GetArray(row, kHeuristicArray);
+  const int* vertices = GetVertices(row);
+  int quantity = quantities_[row];
+  if (alpha == 1) {
+    for (int i = 0; i < quantity; ++i) {
+      choice[i] = pheromones[vertices[i]] * heuristic[i];
+    }
+    return;
+  }
+  for (int i = 0; i < quantity; ++i) {
+    choice[i] = std::pow(pheromones[vertices[i]], alpha) * heuristic[i];
+  }
+}
+
+// Getters
+int CandidateRows::GetQuantity(const size_type row) const {
+  return quantities_[row];
+}
+
+const int* CandidateRows::GetVertices(const size_type row) const {
+  return reinterpret_cast<const int*>(GetArray(row, kVerticesArray));
+}
+
+const double* CandidateRows::GetChoice(const size_type row) const {
+  return GetArray(row, kChoiceArray);
+}
+
+const double* CandidateRows::GetHeuristic(const size_type row) const {
+  return GetArray(row, kHeuristicArray);
+}
+
+const double* CandidateRows::GetDistances(const size_type row) const {
+  return GetArray(row, kDistancesArray);
+}
+
+// Private functions
+double* CandidateRows::GetArray(const size_type row, const int index) {
+  return reinterpret_cast<double*>(lines_[row * row_lines_].bytes) +
+         index * padded_quantity_;
+}
+
+const double* CandidateRows::GetArray(const size_type row,
+                                      const int index) const {
+  return reinterpret_cast<const double*>(lines_[row * row_lines_].bytes) +
+         index * padded_quantity_;
+}
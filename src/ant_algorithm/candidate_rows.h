@@ -0,0 +1,63 @@
+#ifndef ANT_ALGORITHM_CANDIDATE_ROWS_H_
+#define ANT_ALGORITHM_CANDIDATE_ROWS_H_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "prepared_graph.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kCacheLineSize = 64;  // bytes
+constexpr int kRowPadding = kCacheLineSize / sizeof(double);
+constexpr int kChoiceArray = 0;  // arrays of a row in the order of the block
+constexpr int kHeuristicArray = 1;
+constexpr int kDistancesArray = 2;
+constexpr int kVerticesArray = 3;  // ints, after the three double arrays
+
+// The candidate edges of every vertex in one aligned block per row: the
+// choice weights tau^alpha * eta^beta, the heuristic eta^beta, the
+// distances and the candidate vertices, each an array padded to whole
+// cache lines. A step of an ant reads the weights and the vertices of one
+// block front to back and takes the distance of the chosen edge from the
+// same block, instead of gathering from the rows of three n x n matrices
+class CandidateRows {
+ public:
+  using size_type = Matrix::size_type;
+
+ public:
+  // Methods
+  void Setup(const PreparedGraph& graph, const double beta);
+  void UpdateChoice(const size_type row, const double* pheromones,
+                    const double alpha);
+
+  // Getters
+  int GetQuantity(const size_type row) const;
+  const int* GetVertices(const size_type row) const;
+  const double* GetChoice(const size_type row) const;
+  const double* GetHeuristic(const size_type row) const;
+  const double* GetDistances(const size_type row) const;
+
+ private:
+  struct alignas(kCacheLineSize) CacheLine {
+    unsigned char bytes[kCacheLineSize];
+  };
+
+  std::vector<CacheLine> lines_;
+  std::vector<int> quantities_;  // candidates per row
+  int64_t padded_quantity_ = 0;  // entries of each array of a row
+  int64_t row_lines_ = 0;
+
+ private:
+  double* GetArray(const size_type row, const int index);
+  const double* GetArray(const size_type row, const int index) const;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_CANDIDATE_ROWS_H_
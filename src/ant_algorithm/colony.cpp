@@ -0,0 +1,292 @@
+#include "colony.h"
+
+using s21::ant::Colony;
+
+s21::ant::AntParameters s21::ant::GetDefaultParameters(
+    const AntVariant variant) {
+  AntParameters parameters;
+  parameters.variant = variant;
+  if (variant == AntVariant::kMaxMinAntSystem) {
+    parameters.evaporation = kDefaultMaxMinEvaporation;
+  } else if (variant == AntVariant::kAntColonySystem) {
+    parameters.evaporation = kDefaultColonyEvaporation;
+  }
+  return parameters;
+}
+
+// Throws for a parameter out of its range, shared by every colony
+void s21::ant::ValidateParameters(const AntParameters& parameters) {
+  bool needs_evaporation = parameters.variant != AntVariant::kAntSystem;
+  if (parameters.variant < AntVariant::kAntSystem ||
+      parameters.variant > AntVariant::kAntColonySystem ||
+      parameters.alpha < 0 || parameters.beta < 0 ||
+      parameters.evaporation < 0 || parameters.evaporation > 1 ||
+      (needs_evaporation && parameters.evaporation == 0) ||
+      parameters.ants_quantity <= 0 || parameters.exploitation < 0 ||
+      parameters.exploitation > 1 || parameters.local_evaporation < 0 ||
+      parameters.local_evaporation > 1 ||
+      parameters.stopping.stagnation_batches < 0 ||
+      parameters.stopping.branching_factor < 0 ||
+      parameters.stopping.target_distance < 0 ||
+      parameters.stopping.time_budget < 0 || parameters.stopping.gap < 0) {
+    throw s21::InvalidAntParameters();
+  }
+}
+
+// Infinite without a bound or a tour
+double s21::ant::CalculateGap(const double distance, const double lower_bound) {
+  if (lower_bound <= 0 || distance == INFINITY) {
+    return INFINITY;
+  }
+  return std::max(0.0, (distance - lower_bound) / lower_bound);
+}
+
+// Of the tour and its distance, for the result exporters
+uint64_t s21::ant::CalculateDigest(const TsmResult& solution) {
+  uint64_t digest =
+      HashBytes(solution.vertices.data(),
+                solution.vertices.size() * sizeof(int), kDigestOffsetBasis);
+  return HashBytes(&solution.distance, sizeof(solution.distance), digest);
+}
+
+Colony::Colony() {
+  pheromone_handlers_.insert(
+      std::make_pair(AntVariant::kAntSystem, &Colony::AntSystemRows));
+  pheromone_handlers_.insert(std::make_pair(AntVariant::kMaxMinAntSystem,
+                                            &Colony::MaxMinAntSystemRows));
+  pheromone_handlers_.insert(std::make_pair(AntVariant::kAntColonySystem,
+                                            &Colony::AntColonySystemRows));
+}
+
+void Colony::SetParameters(const AntParameters& parameters) {
+  ValidateParameters(parameters);
+  parameters_ = parameters;
+}
+
+const s21::ant::AntParameters& Colony::GetParameters() const {
+  return parameters_;
+}
+
+void Colony::SetImprovementCallback(const improvement_callback& callback) {
+  improvement_callback_ = callback;
+}
+
+// The token is not owned and must outlive the solves that use it, nullptr
+// disables cancellation
+void Colony::SetCancellationToken(
+    const CancellationToken* cancellation_token) {
+  cancellation_token_ = cancellation_token;
+}
+
+int Colony::GetCompletedAntsQuantity() const { return completed_ants_; }
+
+// Runs the same batches as the parallel mode, one ant after another
+void Colony::SolveSequently() {
+  int iterations_quantity = parameters_.ants_quantity;
+  while (iterations_quantity > 0) {
+    RunBatch();
+    iterations_quantity -= kThreadsQuantity;
+    if (ShouldStop()) {
+      break;
+    }
+  }
+}
+
+void Colony::SolveInParallel() {
+  int iterations_quantity = parameters_.ants_quantity;
+  while (iterations_quantity > 0) {
+    S21_TRACE_SCOPE("batch");
+    std::vector<std::thread> threads;
+    ReserveThreadCounters(&thread_counters_, kThreadsQuantity);
+    for (int i = 0; i < kThreadsQuantity; ++i) {
+      threads.push_back(std::thread([this, i]() {
+        ScopedThreadCounters counters(&thread_counters_[i]);
+        AntPassage(i);
+      }));
+    }
+    {
+      S21_TRACE_SCOPE("join");
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    }
+    UpdatePheromones();
+    tsm_result_.ants_quantity = completed_ants_;
+    iterations_quantity -= kThreadsQuantity;
+    if (ShouldStop()) {
+      break;
+    }
+  }
+}
+
+void Colony::RunBatch() {
+  S21_TRACE_SCOPE("batch");
+  for (int i = 0; i < kThreadsQuantity; ++i) {
+    AntPassage(i);
+  }
+  UpdatePheromones();
+  tsm_result_.ants_quantity = completed_ants_;
+}
+
+// New seeds for the ants and a fresh start of the stopping criteria
+void Colony::SetupBatches() {
+  ants_.resize(kThreadsQuantity);
+  std::random_device device;
+  for (Ant& ant : ants_) {
+    ant.Seed((uint64_t{device()} << 32) | device());
+  }
+  budget_timer_.Begin();
+  last_best_distance_ = INFINITY;
+  stagnant_batches_ = 0;
+  batches_quantity_ = 0;
+  tsm_result_.stop_reason = StopReason::kAntsQuantity;
+}
+
+// Ant System starts from kDefaultPheromoneValue, the other variants scale
+// the initial pheromone by the length of a nearest neighbour tour
+void Colony::SetupInitialPheromone(const double nearest_neighbour_distance) {
+  max_pheromone_ = INFINITY;
+  min_pheromone_ = 0;
+  initial_pheromone_ = kDefaultPheromoneValue;
+  if (parameters_.variant == AntVariant::kAntSystem) {
+    return;
+  }
+  if (parameters_.variant == AntVariant::kMaxMinAntSystem) {
+    max_pheromone_ =
+        CalculateTay(nearest_neighbour_distance) / parameters_.evaporation;
+    min_pheromone_ = max_pheromone_ / (2 * GetSize());
+    initial_pheromone_ = max_pheromone_;
+  } else {
+    initial_pheromone_ = CalculateTay(nearest_neighbour_distance) / GetSize();
+  }
+}
+
+// Splits the rows of the colony between threads_quantity_ threads
+void Colony::ProcessRowsInParallel(
+    std::function<void(size_type, size_type)> rows_method) {
+  size_type rows = GetSize();
+  if (threads_quantity_ == 1) {
+    rows_method(0, rows);
+    return;
+  }
+  std::vector<std::thread> threads;
+  for (int i = 1; i <= threads_quantity_; ++i) {
+    threads.push_back(std::thread([this, &rows_method, rows, i]() {
+      S21_TRACE_SCOPE("rows");
+      rows_method((int64_t{rows} * (i - 1)) / threads_quantity_,
+                  (int64_t{rows} * i) / threads_quantity_);
+    }));
+  }
+  S21_TRACE_SCOPE("join");
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// Each thread owns a range of rows, applies the handler of the variant to
+// it in ant order and then updates its choice info, so the result does not
+// depend on thread timing
+void Colony::UpdatePheromones() {
+  S21_TRACE_SCOPE("update pheromones");
+  FindBatchBestAnt();
+  ImproveBatchBestTour();
+  UpdatePheromoneLimits();
+  rows_handler handler = pheromone_handlers_.at(parameters_.variant);
+  ProcessRowsInParallel([this, handler](size_type first_row,
+                                        size_type last_row) {
+    (this->*handler)(first_row, last_row);
+    UpdateChoiceInfoRows(first_row, last_row);
+  });
+}
+
+// MAX-MIN Ant System bounds the trail by the best tour so far
+void Colony::UpdatePheromoneLimits() {
+  if (parameters_.variant == AntVariant::kMaxMinAntSystem &&
+      tsm_result_.distance != INFINITY) {
+    max_pheromone_ =
+        CalculateTay(tsm_result_.distance) / parameters_.evaporation;
+    min_pheromone_ = max_pheromone_ / (2 * GetSize());
+  }
+}
+
+void Colony::UpdateBestTour(const Ant& ant) {
+  mtx_.lock();
+  if (ant.GetDistance() < tsm_result_.distance) {
+    tsm_result_.distance = ant.GetDistance();
+    tsm_result_.vertices = ant.GetTour();
+    if (improvement_callback_) {
+      improvement_callback_(Improvement{ant.GetTour(), ant.GetDistance(),
+                                        solve_timer_.Timestamp(),
+                                        completed_ants_});
+    }
+  }
+  mtx_.unlock();
+}
+
+double Colony::CalculateTay(const double current_distance) const {
+  return mean_weight_ / current_distance;
+}
+
+// Sets the stop reason of the best tour when a criterion fires. Stagnation
+// counts batches without a shorter tour since SetupBatches
+bool Colony::ShouldStop() {
+  const StoppingCriteria& stopping = parameters_.stopping;
+  ++batches_quantity_;
+  if (batch_best_ant_ != kDefaultNextVertexValue &&
+      ants_[batch_best_ant_].GetDistance() < last_best_distance_) {
+    last_best_distance_ = ants_[batch_best_ant_].GetDistance();
+    stagnant_batches_ = 0;
+  } else {
+    ++stagnant_batches_;
+  }
+  StopReason stop_reason = StopReason::kAntsQuantity;
+  if (IsCancelled()) {
+    stop_reason = StopReason::kCancelled;
+  } else if (stopping.target_distance > 0 &&
+      tsm_result_.distance <= stopping.target_distance) {
+    stop_reason = StopReason::kTargetDistance;
+  } else if (stopping.gap > 0 &&
+             CalculateGap(tsm_result_.distance, lower_bound_) <=
+                 stopping.gap) {
+    stop_reason = StopReason::kGap;
+  } else if (stopping.stagnation_batches > 0 &&
+             stagnant_batches_ >= stopping.stagnation_batches) {
+    stop_reason = StopReason::kStagnation;
+  } else if (stopping.time_budget > 0 &&
+             budget_timer_.Timestamp().GetMilliseconds() >=
+                 stopping.time_budget) {
+    stop_reason = StopReason::kTimeBudget;
+  } else if (stopping.branching_factor > 0 &&
+             batches_quantity_ >= kMinimumBranchingBatches &&
+             CalculateBranchingFactor() <= stopping.branching_factor) {
+    stop_reason = StopReason::kBranchingFactor;
+  }
+  tsm_result_.stop_reason = stop_reason;
+  return stop_reason != StopReason::kAntsQuantity;
+}
+
+bool Colony::IsCancelled() const {
+  return cancellation_token_ != nullptr && cancellation_token_->IsCancelled();
+}
+
+bool Colony::IsLowerBoundNeeded() const {
+  return parameters_.lower_bound || parameters_.stopping.gap > 0;
+}
+
+// Colonies without local search keep the tours of their ants
+void Colony::ImproveBatchBestTour() {}
+
+// Private functions
+
+// The shortest complete tour of the batch, an ant abandoned at a dead end
+// or before its start has none
+void Colony::FindBatchBestAnt() {
+  batch_best_ant_ = kDefaultNextVertexValue;
+  for (size_t i = 0; i < ants_.size(); ++i) {
+    if (ants_[i].GetDistance() != INFINITY &&
+        (batch_best_ant_ == kDefaultNextVertexValue ||
+         ants_[i].GetDistance() < ants_[batch_best_ant_].GetDistance())) {
+      batch_best_ant_ = i;
+    }
+  }
+}
@@ -0,0 +1,210 @@
+#ifndef ANT_ALGORITHM_COLONY_H_
+#define ANT_ALGORITHM_COLONY_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../exceptions/exceptions.h"
+#include "../result_exporter/result_exporter.h"
+#include "../timer/timer.h"
+#include "../tracing/tracing.h"
+#include "ant.h"
+#include "cancellation_token.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kIterationsQuantity = 24000;
+constexpr int kDefaultPheromoneValue = 1;
+constexpr int kDefaultNextVertexValue = -1;
+constexpr int kThreadsQuantity = 8;
+constexpr double kDefaultAlpha = 1;  // pheromone exponent
+constexpr double kDefaultBeta = 1;   // heuristic exponent
+constexpr double kDefaultMaxMinEvaporation = 0.02;
+constexpr double kDefaultColonyEvaporation = 0.1;
+constexpr double kDefaultExploitation = 0.9;       // q0 of the colony system
+constexpr double kDefaultLocalEvaporation = 0.1;   // xi of the colony system
+constexpr int kAliasAttempts = 4;  // draws before an alias table gives up
+
+enum class LocalSearchMode : int {
+  kNone = 0,
+  kEveryAnt,   // every ant improves its own tour in its thread
+  kBatchBest,  // only the best tour of a batch is improved
+};
+
+enum class StopReason : int {
+  kAntsQuantity = 0,  // all ants of AntParameters::ants_quantity were built
+  kStagnation,
+  kBranchingFactor,
+  kTargetDistance,
+  kTimeBudget,
+  kCancelled,
+  kGap,  // the best tour came within StoppingCriteria::gap of the bound
+};
+
+// Checked after every batch, a zero value disables a criterion
+struct StoppingCriteria {
+  int stagnation_batches{0};  // batches without a shorter tour
+  double branching_factor{0};  // mean lambda-branching factor to converge at
+  double target_distance{0};
+  int64_t time_budget{0};  // milliseconds
+  double gap{0};  // relative to the lower bound, which it computes
+};
+
+enum class SelectionMethod : int {
+  kRoulette = 0,  // prefix sums over the unvisited vertices of every step
+  kAliasTable,    // a table per candidate row, built once per batch
+};
+
+enum class AntVariant : int {
+  kAntSystem = 0,
+  kMaxMinAntSystem,
+  kAntColonySystem,
+};
+
+// Ant System deposits the tours of all ants, MAX-MIN Ant System only the
+// best tour of a batch inside [tau_min, tau_max] and Ant Colony System the
+// best tour so far, with a local update of every edge an ant walked and the
+// pseudo-random proportional rule. Ants are counted in batches of
+// kThreadsQuantity, pheromones change once per batch.
+struct AntParameters {
+  AntVariant variant{AntVariant::kAntSystem};
+  double alpha{kDefaultAlpha};
+  double beta{kDefaultBeta};
+  double evaporation{0};  // rho, ant system does not evaporate by default
+  int ants_quantity{kIterationsQuantity};
+  double exploitation{kDefaultExploitation};
+  double local_evaporation{kDefaultLocalEvaporation};
+  LocalSearchMode local_search{LocalSearchMode::kNone};
+  StoppingCriteria stopping;
+  SelectionMethod selection{SelectionMethod::kRoulette};
+  bool lower_bound{false};  // report the bound and the gap of the best tour
+};
+
+AntParameters GetDefaultParameters(const AntVariant variant);
+void ValidateParameters(const AntParameters& parameters);
+
+constexpr double kBranchingFactorLambda = 0.05;
+constexpr int kMinimumBranchingBatches = 10;  // before the trail is measured
+
+struct TsmResult {
+  std::vector<int> vertices;
+  double distance{INFINITY};
+  StopReason stop_reason{StopReason::kAntsQuantity};
+  int ants_quantity{0};  // ants built before the stop
+  double lower_bound{0};  // 0 when it was not computed
+  double gap{INFINITY};  // (distance - lower_bound) / lower_bound
+};
+
+double CalculateGap(const double distance, const double lower_bound);
+uint64_t CalculateDigest(const TsmResult& solution);
+
+// A tour shorter than every tour found before it in the same solve
+struct Improvement {
+  std::vector<int> vertices;
+  double distance;
+  TimeRange elapsed;  // since the solve began
+  int ants_quantity;  // ants built so far
+};
+
+// Called from the thread of the ant that found the tour, one call at a
+// time and in the order of improvement, so it should return quickly
+using improvement_callback = std::function<void(const Improvement&)>;
+
+// What the colonies share whatever their pheromone storage: the parameters,
+// the batches of kThreadsQuantity ants, the stopping criteria and the
+// pheromone update of the variants. A colony gives the walk of an ant, the
+// handler of every variant over a range of rows and its choice info
+class Colony {
+ public:
+  using size_type = int;
+  using solution_type = TsmResult;
+  using result_type = AlgorithmResult<solution_type>;
+  using rows_handler = void (Colony::*)(size_type, size_type);
+  using handlers_type = std::map<AntVariant, rows_handler>;
+
+ public:
+  Colony();
+  Colony(const Colony& other) = delete;
+  Colony& operator=(const Colony& other) = delete;
+  virtual ~Colony() = default;
+
+  void SetParameters(const AntParameters& parameters);
+  const AntParameters& GetParameters() const;
+  void SetImprovementCallback(const improvement_callback& callback);
+  void SetCancellationToken(const CancellationToken* cancellation_token);
+  int GetCompletedAntsQuantity() const;
+
+ protected:
+  TsmResult tsm_result_;
+  result_type result_;
+  std::vector<Ant> ants_;  // one reusable tour per thread
+  std::mutex mtx_;
+  int threads_quantity_ = 1;
+  AntParameters parameters_;
+  double mean_weight_ = 0;  // Q of the deposits
+  double initial_pheromone_ = kDefaultPheromoneValue;  // tau0
+  double max_pheromone_ = INFINITY;
+  double min_pheromone_ = 0;
+  int batch_best_ant_ = kDefaultNextVertexValue;
+  Timer budget_timer_;
+  double last_best_distance_ = INFINITY;
+  int stagnant_batches_ = 0;
+  int batches_quantity_ = 0;  // batches since SetupBatches
+  double lower_bound_ = 0;
+  improvement_callback improvement_callback_;
+  const CancellationToken* cancellation_token_ = nullptr;
+  std::atomic<int> completed_ants_{0};
+  Timer solve_timer_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
+
+ protected:
+  void SolveSequently();
+  void SolveInParallel();
+  void RunBatch();
+  void SetupBatches();
+  void SetupInitialPheromone(const double nearest_neighbour_distance);
+  void ProcessRowsInParallel(
+      std::function<void(size_type, size_type)> rows_method);
+  void UpdatePheromones();
+  void UpdatePheromoneLimits();
+  void UpdateBestTour(const Ant& ant);
+  double CalculateTay(const double current_distance) const;
+  bool ShouldStop();
+  bool IsCancelled() const;
+  bool IsLowerBoundNeeded() const;
+
+  virtual size_type GetSize() const = 0;
+  virtual void AntPassage(const int ant_index) = 0;
+  virtual void ImproveBatchBestTour();
+  virtual void UpdateChoiceInfoRows(const size_type first_row,
+                                    const size_type last_row) = 0;
+  virtual void AntSystemRows(const size_type first_row,
+                             const size_type last_row) = 0;
+  virtual void MaxMinAntSystemRows(const size_type first_row,
+                                   const size_type last_row) = 0;
+  virtual void AntColonySystemRows(const size_type first_row,
+                                   const size_type last_row) = 0;
+  virtual double CalculateBranchingFactor() = 0;
+
+ private:
+  handlers_type pheromone_handlers_;
+
+ private:
+  void FindBatchBestAnt();
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_COLONY_H_
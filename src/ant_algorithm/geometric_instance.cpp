@@ -0,0 +1,237 @@
+#include "geometric_instance.h"
+
+using s21::ant::GeometricInstance;
+
+// Constructors
+GeometricInstance::GeometricInstance(const EdgeWeightType type,
+                                     const std::vector<double>& x,
+                                     const std::vector<double>& y)
+    : type_(type), x_(x), y_(y) {
+  if (x.size() != y.size() || x.size() < 2) {
+    throw s21::InvalidMatrixSizes();
+  }
+  if (type_ == EdgeWeightType::kGeographical) {
+    std::transform(x_.begin(), x_.end(), x_.begin(), ToRadians);
+    std::transform(y_.begin(), y_.end(), y_.begin(), ToRadians);
+  }
+}
+
+// Methods
+double GeometricInstance::Distance(const size_type from,
+                                   const size_type to) const {
+  double distance = 0;
+  Distances(from, &to, 1, &distance);
+  return distance;
+}
+
+// Distances from one city to a list of cities, rounded as in TSPLIB
+void GeometricInstance::Distances(const size_type from,
+                                  const size_type* vertices,
+                                  const size_type quantity,
+                                  double* distances) const {
+  const double* x = x_.data();
+  const double* y = y_.data();
+  double from_x = x[from], from_y = y[from];
+  if (type_ == EdgeWeightType::kEuclidean2d) {
+    for (size_type i = 0; i < quantity; ++i) {
+      double dx = from_x - x[vertices[i]], dy = from_y - y[vertices[i]];
+      distances[i] = std::floor(std::sqrt(dx * dx + dy * dy) + 0.5);
+    }
+  } else if (type_ == EdgeWeightType::kPseudoEuclidean) {
+    for (size_type i = 0; i < quantity; ++i) {
+      double dx = from_x - x[vertices[i]], dy = from_y - y[vertices[i]];
+      double r = std::sqrt((dx * dx + dy * dy) / 10);
+      distances[i] = std::ceil(r);
+    }
+  } else {
+    for (size_type i = 0; i < quantity; ++i) {
+      double q1 = std::cos(from_y - y[vertices[i]]);
+      double q2 = std::cos(from_x - x[vertices[i]]);
+      double q3 = std::cos(from_x + x[vertices[i]]);
+      distances[i] = std::floor(
+          kEarthRadius * std::acos(0.5 * ((1 + q1) * q2 - (1 - q1) * q3)) + 1);
+    }
+  }
+}
+
+// The quantity nearest cities of every city, row after row. Euclidean and
+// pseudo-Euclidean distances grow with the plane distance, so a grid finds
+// them in about O(n * quantity); geographical ones are compared with every
+// city. Rows are split between threads
+std::vector<typename GeometricInstance::size_type>
+GeometricInstance::FindNearestNeighbours(const size_type quantity) const {
+  size_type size = GetSize();
+  size_type neighbours_quantity = std::min(quantity, size - 1);
+  std::vector<size_type> neighbours(size * neighbours_quantity);
+  Grid grid;
+  if (type_ != EdgeWeightType::kGeographical) {
+    grid = BuildGrid();
+  }
+  int threads_quantity =
+      std::max<int>(1, std::min<int>(std::thread::hardware_concurrency(), size));
+  std::vector<std::thread> threads;
+  for (int i = 1; i <= threads_quantity; ++i) {
+    size_type first = (int64_t{size} * (i - 1)) / threads_quantity;
+    size_type last = (int64_t{size} * i) / threads_quantity;
+    if (type_ == EdgeWeightType::kGeographical) {
+      threads.push_back(std::thread(&GeometricInstance::FindAllNeighbours, this,
+                                    neighbours_quantity, first, last,
+                                    &neighbours));
+    } else {
+      threads.push_back(std::thread(&GeometricInstance::FindGridNeighbours,
+                                    this, std::cref(grid), neighbours_quantity,
+                                    first, last, &neighbours));
+    }
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return neighbours;
+}
+
+// Dense distances for the solvers that need a matrix. A zero weight means
+// a missing edge there, so coincident cities get kMinimumGeometricDistance
+s21::Matrix GeometricInstance::ToMatrix() const {
+  size_type size = GetSize();
+  Matrix matrix(size, size);
+  std::vector<size_type> vertices(size);
+  for (size_type i = 0; i < size; ++i) {
+    vertices[i] = i;
+  }
+  for (size_type i = 0; i < size; ++i) {
+    double* row = &matrix(i, 0);
+    Distances(i, vertices.data(), size, row);
+    for (size_type j = 0; j < size; ++j) {
+      if (i != j && row[j] == 0) {
+        row[j] = kMinimumGeometricDistance;
+      }
+    }
+    row[i] = 0;
+  }
+  return matrix;
+}
+
+// Getters
+typename GeometricInstance::size_type GeometricInstance::GetSize() const {
+  return x_.size();
+}
+
+s21::ant::EdgeWeightType GeometricInstance::GetType() const { return type_; }
+
+// Private functions
+typename GeometricInstance::Grid GeometricInstance::BuildGrid() const {
+  size_type size = GetSize();
+  Grid grid;
+  auto x_range = std::minmax_element(x_.begin(), x_.end());
+  auto y_range = std::minmax_element(y_.begin(), y_.end());
+  grid.min_x = *x_range.first;
+  grid.min_y = *y_range.first;
+  grid.cells_per_side = std::max<size_type>(
+      1, std::ceil(std::sqrt(static_cast<double>(size) / kPointsPerGridCell)));
+  double extent = std::max(*x_range.second - grid.min_x,
+                           *y_range.second - grid.min_y);
+  grid.cell_size = extent > 0 ? extent / grid.cells_per_side : 1;
+  int64_t cells_quantity = int64_t{grid.cells_per_side} * grid.cells_per_side;
+  grid.cell_offsets.assign(cells_quantity + 1, 0);
+  std::vector<size_type> cells(size);
+  for (size_type i = 0; i < size; ++i) {
+    size_type column = std::min<size_type>(
+        grid.cells_per_side - 1, (x_[i] - grid.min_x) / grid.cell_size);
+    size_type row = std::min<size_type>(grid.cells_per_side - 1,
+                                        (y_[i] - grid.min_y) / grid.cell_size);
+    cells[i] = row * grid.cells_per_side + column;
+    ++grid.cell_offsets[cells[i] + 1];
+  }
+  for (int64_t cell = 0; cell < cells_quantity; ++cell) {
+    grid.cell_offsets[cell + 1] += grid.cell_offsets[cell];
+  }
+  grid.points.resize(size);
+  std::vector<size_type> filled(grid.cell_offsets.begin(),
+                                grid.cell_offsets.end() - 1);
+  for (size_type i = 0; i < size; ++i) {
+    grid.points[filled[cells[i]]++] = i;
+  }
+  return grid;
+}
+
+// Visits square rings of cells around the city and stops when the ring is
+// farther than the worst of the nearest cities found so far
+void GeometricInstance::FindGridNeighbours(
+    const Grid& grid, const size_type quantity, const size_type first,
+    const size_type last, std::vector<size_type>* neighbours) const {
+  std::vector<std::pair<double, size_type>> nearest;
+  auto is_closer = [](const std::pair<double, size_type>& lhs,
+                      const std::pair<double, size_type>& rhs) {
+    return lhs < rhs;
+  };
+  for (size_type point = first; point < last; ++point) {
+    nearest.clear();
+    size_type column = std::min<size_type>(
+        grid.cells_per_side - 1, (x_[point] - grid.min_x) / grid.cell_size);
+    size_type row = std::min<size_type>(
+        grid.cells_per_side - 1, (y_[point] - grid.min_y) / grid.cell_size);
+    for (size_type ring = 0; ring <= grid.cells_per_side; ++ring) {
+      for (size_type i = row - ring; i <= row + ring; ++i) {
+        if (i < 0 || i >= grid.cells_per_side) continue;
+        bool is_edge_row = i == row - ring || i == row + ring;
+        for (size_type j = column - ring; j <= column + ring;
+             j += is_edge_row ? 1 : 2 * std::max(ring, 1)) {
+          if (j < 0 || j >= grid.cells_per_side) continue;
+          int64_t cell = int64_t{i} * grid.cells_per_side + j;
+          for (size_type k = grid.cell_offsets[cell];
+               k < grid.cell_offsets[cell + 1]; ++k) {
+            size_type other = grid.points[k];
+            if (other == point) continue;
+            double dx = x_[point] - x_[other], dy = y_[point] - y_[other];
+            std::pair<double, size_type> candidate(dx * dx + dy * dy, other);
+            if (static_cast<size_type>(nearest.size()) < quantity) {
+              nearest.push_back(candidate);
+              std::push_heap(nearest.begin(), nearest.end(), is_closer);
+            } else if (candidate < nearest.front()) {
+              std::pop_heap(nearest.begin(), nearest.end(), is_closer);
+              nearest.back() = candidate;
+              std::push_heap(nearest.begin(), nearest.end(), is_closer);
+            }
+          }
+        }
+      }
+      double reach = ring * grid.cell_size;
+      if (static_cast<size_type>(nearest.size()) == quantity &&
+          reach * reach >= nearest.front().first) {
+        break;
+      }
+    }
+    std::sort_heap(nearest.begin(), nearest.end(), is_closer);
+    for (size_type k = 0; k < quantity; ++k) {
+      (*neighbours)[int64_t{point} * quantity + k] = nearest[k].second;
+    }
+  }
+}
+
+void GeometricInstance::FindAllNeighbours(
+    const size_type quantity, const size_type first, const size_type last,
+    std::vector<size_type>* neighbours) const {
+  size_type size = GetSize();
+  std::vector<size_type> vertices(size);
+  std::vector<double> distances(size);
+  for (size_type point = first; point < last; ++point) {
+    for (size_type i = 0; i < size; ++i) {
+      vertices[i] = i;
+    }
+    Distances(point, vertices.data(), size, distances.data());
+    distances[point] = INFINITY;
+    std::partial_sort(vertices.begin(), vertices.begin() + quantity,
+                      vertices.end(), [&distances](size_type lhs, size_type rhs) {
+                        return distances[lhs] < distances[rhs] ||
+                               (distances[lhs] == distances[rhs] && lhs < rhs);
+                      });
+    std::copy(vertices.begin(), vertices.begin() + quantity,
+              neighbours->begin() + int64_t{point} * quantity);
+  }
+}
+
+double GeometricInstance::ToRadians(const double coordinate) {
+  double degrees = std::trunc(coordinate);
+  double minutes = coordinate - degrees;
+  return kGeographicalPi * (degrees + 5 * minutes / 3) / 180;
+}
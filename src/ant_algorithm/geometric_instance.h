@@ -0,0 +1,82 @@
+#ifndef ANT_ALGORITHM_GEOMETRIC_INSTANCE_H_
+#define ANT_ALGORITHM_GEOMETRIC_INSTANCE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr double kGeographicalPi = 3.141592;  // the value fixed by TSPLIB
+constexpr double kEarthRadius = 6378.388;
+constexpr int kPointsPerGridCell = 2;
+constexpr double kMinimumGeometricDistance = 1e-3;
+
+enum class EdgeWeightType : int {
+  kEuclidean2d = 0,  // EUC_2D
+  kGeographical,     // GEO
+  kPseudoEuclidean,  // ATT
+};
+
+// Cities given by coordinates, distances follow the TSPLIB definitions and
+// are computed when asked for, so memory grows linearly with the cities.
+// Coordinates are kept as separate arrays and the batch Distances loop has
+// no branches, so the compiler can vectorize it.
+class GeometricInstance {
+ public:
+  using size_type = int;
+
+ public:
+  // Constructors
+  GeometricInstance() = default;
+  GeometricInstance(const EdgeWeightType type, const std::vector<double>& x,
+                    const std::vector<double>& y);
+
+  // Methods
+  double Distance(const size_type from, const size_type to) const;
+  void Distances(const size_type from, const size_type* vertices,
+                 const size_type quantity, double* distances) const;
+  std::vector<size_type> FindNearestNeighbours(const size_type quantity) const;
+  Matrix ToMatrix() const;
+
+  // Getters
+  size_type GetSize() const;
+  EdgeWeightType GetType() const;
+
+ private:
+  EdgeWeightType type_ = EdgeWeightType::kEuclidean2d;
+  std::vector<double> x_;  // latitudes in radians for GEO
+  std::vector<double> y_;  // longitudes in radians for GEO
+
+  // Square cells over the bounding box, points of a cell are contiguous
+  struct Grid {
+    double min_x, min_y, cell_size;
+    size_type cells_per_side;
+    std::vector<size_type> cell_offsets;
+    std::vector<size_type> points;
+  };
+
+ private:
+  Grid BuildGrid() const;
+  void FindGridNeighbours(const Grid& grid, const size_type quantity,
+                          const size_type first,
+                          const size_type last,
+                          std::vector<size_type>* neighbours) const;
+  void FindAllNeighbours(const size_type quantity, const size_type first,
+                         const size_type last,
+                         std::vector<size_type>* neighbours) const;
+  static double ToRadians(const double coordinate);
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_GEOMETRIC_INSTANCE_H_
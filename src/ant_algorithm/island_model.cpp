@@ -0,0 +1,215 @@
+#include "island_model.h"
+
+using s21::ant::IslandModel;
+
+// Methods
+
+// Colonies that met a stopping criterion stay idle, the run ends when all of
+// them have stopped. The lower bound is computed with all threads before
+// the colonies start. Between two barriers the colony threads run a round
+// of batches, after the second one the solving thread decides whether the
+// colonies migrate and go on or the iteration is over
+typename IslandModel::result_type IslandModel::Solve(
+    const Matrix& graph, const int iterations_quantity) {
+  result_.Reset();
+  if (prepared_graph_ == nullptr ||
+      !prepared_graph_->IsPreparedFor(graph, candidates_quantity_)) {
+    prepared_graph_ =
+        std::make_shared<const PreparedGraph>(graph, candidates_quantity_);
+  }
+  double lower_bound = 0;
+  if (parameters_.lower_bound || parameters_.stopping.gap > 0) {
+    lower_bound = prepared_graph_->GetLowerBound(kThreadsQuantity);
+  }
+  SetupColonies();
+  best_distance_ = INFINITY;
+  solve_timer_.Begin();
+  TsmResult tsm_result;
+  int batches_quantity =
+      (parameters_.ants_quantity + kThreadsQuantity - 1) / kThreadsQuantity;
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  barrier_.reset(new Barrier(colonies_.size() + 1));
+  is_finished_ = false;
+  ReserveThreadCounters(&thread_counters_, colonies_.size());
+  std::vector<std::thread> threads;
+  for (size_t colony = 0; colony < colonies_.size(); ++colony) {
+    threads.push_back(std::thread(&IslandModel::RunColony, this, colony));
+  }
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    int remaining_batches = batches_quantity;
+    round_batches_ =
+        std::min(remaining_batches, island_parameters_.migration_interval);
+    is_stopped_.assign(colonies_.size(), 0);
+    barrier_->Wait();
+    do {
+      barrier_->Wait();
+      remaining_batches -= round_batches_;
+      round_batches_ =
+          std::min(remaining_batches, island_parameters_.migration_interval);
+      is_iteration_over_ =
+          remaining_batches == 0 ||
+          std::count(is_stopped_.begin(), is_stopped_.end(), 0) == 0;
+      is_migrating_ = !is_iteration_over_;
+      if (is_migrating_) {
+        ChooseMigrants();
+      }
+      barrier_->Wait();
+    } while (!is_iteration_over_);
+    barrier_->Wait();
+    TsmResult best_tour = GetBestTour();
+    int ants_quantity = tsm_result.ants_quantity;
+    if (best_tour.distance < tsm_result.distance) {
+      tsm_result = best_tour;
+    }
+    tsm_result.ants_quantity = ants_quantity;
+    for (std::unique_ptr<AntAlgorithm>& colony : colonies_) {
+      tsm_result.ants_quantity += colony->GetBestTour().ants_quantity;
+    }
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.assign(colonies_.size(), PerfSample());
+    if (cancellation_token_ != nullptr && cancellation_token_->IsCancelled()) {
+      break;
+    }
+  }
+  is_finished_ = true;
+  barrier_->Wait();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  thread_counters_.clear();
+  tsm_result.lower_bound = lower_bound;
+  tsm_result.gap = CalculateGap(tsm_result.distance, lower_bound);
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(tsm_result);
+  return result_;
+}
+
+// Setters
+void IslandModel::SetParameters(const AntParameters& parameters) {
+  ValidateParameters(parameters);
+  parameters_ = parameters;
+}
+
+void IslandModel::SetIslandParameters(
+    const IslandParameters& island_parameters) {
+  if (island_parameters.islands_quantity <= 0 ||
+      island_parameters.migration_interval <= 0) {
+    throw s21::InvalidAntParameters();
+  }
+  island_parameters_ = island_parameters;
+}
+
+void IslandModel::SetCandidatesQuantity(const int candidates_quantity) {
+  candidates_quantity_ = std::max(1, candidates_quantity);
+}
+
+void IslandModel::SetImprovementCallback(
+    const improvement_callback& callback) {
+  improvement_callback_ = callback;
+}
+
+void IslandModel::SetCancellationToken(
+    const CancellationToken* cancellation_token) {
+  cancellation_token_ = cancellation_token;
+}
+
+// Private functions
+void IslandModel::SetupColonies() {
+  colonies_.clear();
+  for (int i = 0; i < island_parameters_.islands_quantity; ++i) {
+    colonies_.push_back(std::unique_ptr<AntAlgorithm>(new AntAlgorithm()));
+    colonies_.back()->SetParameters(parameters_);
+    colonies_.back()->SetCandidatesQuantity(candidates_quantity_);
+    colonies_.back()->SetCancellationToken(cancellation_token_);
+    if (improvement_callback_) {
+      colonies_.back()->SetImprovementCallback(std::bind(
+          &IslandModel::ReportImprovement, this, std::placeholders::_1));
+    }
+  }
+}
+
+// Colonies report their own improvements, only those that beat every
+// colony reach the callback, with the ants of all colonies
+void IslandModel::ReportImprovement(const Improvement& improvement) {
+  mtx_.lock();
+  if (improvement.distance < best_distance_) {
+    best_distance_ = improvement.distance;
+    Improvement island_improvement = improvement;
+    island_improvement.elapsed = solve_timer_.Timestamp();
+    island_improvement.ants_quantity = 0;
+    for (std::unique_ptr<AntAlgorithm>& colony : colonies_) {
+      island_improvement.ants_quantity += colony->GetCompletedAntsQuantity();
+    }
+    improvement_callback_(island_improvement);
+  }
+  mtx_.unlock();
+}
+
+// A colony thread lives for the whole solve. It waits at the barrier for
+// each iteration, and after every round for the decision of the solving
+// thread; migrants are accepted by the colonies' own threads
+void IslandModel::RunColony(const int colony) {
+  AntAlgorithm& ant_algorithm = *colonies_[colony];
+  while (true) {
+    barrier_->Wait();
+    if (is_finished_) {
+      return;
+    }
+    {
+      ScopedThreadCounters counters(&thread_counters_[colony]);
+      S21_TRACE_SCOPE("colony");
+      ant_algorithm.Prepare(prepared_graph_);
+      do {
+        is_stopped_[colony] = ant_algorithm.RunBatches(round_batches_);
+        {
+          S21_TRACE_SCOPE("migration barrier");
+          barrier_->Wait();
+          barrier_->Wait();
+        }
+        if (is_migrating_ && ant_algorithm.GetBestTour().vertices !=
+                                 migrants_[colony].vertices) {
+          ant_algorithm.AcceptMigrant(migrants_[colony]);
+        }
+      } while (!is_iteration_over_);
+    }
+    barrier_->Wait();
+  }
+}
+
+// Migrants are chosen before any colony accepts one, so the result does
+// not depend on the order of the colonies. Colonies that already hold the
+// migrant tour skip it
+void IslandModel::ChooseMigrants() {
+  S21_TRACE_SCOPE("migrate");
+  int islands_quantity = colonies_.size();
+  migrants_.clear();
+  if (island_parameters_.topology == IslandTopology::kRing) {
+    for (int i = 0; i < islands_quantity; ++i) {
+      migrants_.push_back(
+          colonies_[(i + islands_quantity - 1) % islands_quantity]
+              ->GetBestTour());
+    }
+  } else {
+    migrants_.assign(islands_quantity, GetBestTour());
+  }
+}
+
+s21::ant::TsmResult IslandModel::GetBestTour() const {
+  TsmResult best_tour;
+  for (const std::unique_ptr<AntAlgorithm>& colony : colonies_) {
+    if (colony->GetBestTour().distance < best_tour.distance) {
+      best_tour = colony->GetBestTour();
+    }
+  }
+  return best_tour;
+}
@@ -0,0 +1,89 @@
+#ifndef ANT_ALGORITHM_ISLAND_MODEL_H_
+#define ANT_ALGORITHM_ISLAND_MODEL_H_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ant_algorithm.h"
+#include "barrier.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kDefaultIslandsQuantity = 4;
+constexpr int kDefaultMigrationInterval = 25;  // batches between migrations
+
+enum class IslandTopology : int {
+  kRing = 0,  // every colony receives the best tour of the previous one
+  kAllToAll,  // every colony receives the best tour of all colonies
+};
+
+struct IslandParameters {
+  int islands_quantity{kDefaultIslandsQuantity};
+  int migration_interval{kDefaultMigrationInterval};
+  IslandTopology topology{IslandTopology::kRing};
+};
+
+// Independent colonies with their own pheromones, one thread each for the
+// whole solve. Every colony constructs AntParameters::ants_quantity ants in
+// batches and the colonies exchange their best tours after every
+// migration_interval batches, at a barrier that is the only point where
+// they synchronize. The colonies share one prepared graph, kept for the
+// next solve of the same graph.
+class IslandModel {
+ public:
+  using result_type = AntAlgorithm::result_type;
+
+ public:
+  // Methods
+  result_type Solve(const Matrix& graph, const int iterations_quantity);
+
+  // Setters
+  void SetParameters(const AntParameters& parameters);
+  void SetIslandParameters(const IslandParameters& island_parameters);
+  void SetCandidatesQuantity(const int candidates_quantity);
+  void SetImprovementCallback(const improvement_callback& callback);
+  void SetCancellationToken(const CancellationToken* cancellation_token);
+
+ private:
+  AntParameters parameters_;
+  IslandParameters island_parameters_;
+  int candidates_quantity_ = kDefaultCandidatesQuantity;
+  std::vector<std::unique_ptr<AntAlgorithm>> colonies_;
+  std::shared_ptr<const PreparedGraph> prepared_graph_;  // of all colonies
+  result_type result_;
+  improvement_callback improvement_callback_;
+  const CancellationToken* cancellation_token_ = nullptr;
+  std::mutex mtx_;
+  double best_distance_ = INFINITY;  // of all colonies in the current solve
+  Timer solve_timer_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
+
+  // Shared with the colony threads, written by the solving thread only while
+  // they wait at the barrier
+  std::unique_ptr<Barrier> barrier_;
+  int round_batches_ = 0;
+  bool is_migrating_ = false;
+  bool is_iteration_over_ = false;
+  bool is_finished_ = false;
+  std::vector<char> is_stopped_;  // written by the colony threads
+  std::vector<TsmResult> migrants_;
+
+ private:
+  void SetupColonies();
+  void RunColony(const int colony);
+  void ChooseMigrants();
+  void ReportImprovement(const Improvement& improvement);
+  TsmResult GetBestTour() const;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_ISLAND_MODEL_H_
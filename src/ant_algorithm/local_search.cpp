@@ -0,0 +1,208 @@
+#include "local_search.h"
+
+using s21::ant::LocalSearch;
+
+// Methods
+void LocalSearch::Setup(const Matrix* graph,
+                        const std::vector<std::vector<int>>* neighbours,
+                        const bool is_symmetric) {
+  graph_ = graph;
+  neighbours_ = neighbours;
+  is_symmetric_ = is_symmetric;
+}
+
+// Takes a closed tour (the first vertex repeated at the end), improves it
+// until no move applies and returns its distance. The improved tour starts
+// from the same vertex
+double LocalSearch::Improve(const std::vector<int>& tour) {
+  int n = tour.size() - 1;
+  tour_.assign(tour.begin(), tour.end() - 1);
+  positions_.resize(n);
+  is_queued_.assign(n, 1);
+  queue_.assign(tour_.begin(), tour_.end());
+  for (int i = 0; i < n; ++i) {
+    positions_[tour_[i]] = i;
+  }
+  while (!queue_.empty()) {
+    int vertex = queue_.front();
+    queue_.pop_front();
+    is_queued_[vertex] = 0;
+    ImproveVertex(vertex);
+  }
+  std::rotate(tour_.begin(), tour_.begin() + positions_[tour.front()],
+              tour_.end());
+  tour_.push_back(tour_.front());
+  double distance = 0;
+  for (int i = 1; i <= n; ++i) {
+    distance += Distance(tour_[i - 1], tour_[i]);
+  }
+  return distance;
+}
+
+// Getters
+const std::vector<int>& LocalSearch::GetTour() const { return tour_; }
+
+// Private functions
+bool LocalSearch::ImproveVertex(const int vertex) {
+  return (is_symmetric_ && TryTwoOpt(vertex)) || TryOrOpt(vertex);
+}
+
+// Replaces the edges (a, b) and (c, d) by (a, c) and (b, d) for b next to a
+// on either side. Only neighbours c closer to a than b can give a gain
+bool LocalSearch::TryTwoOpt(const int a) {
+  for (int is_forward = 1; is_forward >= 0; --is_forward) {
+    int b = is_forward ? Next(a) : Previous(a);
+    double removed = Distance(a, b);
+    for (int c : (*neighbours_)[a]) {
+      if (Distance(a, c) + kImprovementEpsilon >= removed) {
+        break;
+      }
+      int d = is_forward ? Next(c) : Previous(c);
+      if (c == b || d == a || !HasEdge(b, d)) {
+        continue;
+      }
+      double delta = Distance(a, c) + Distance(b, d) - removed - Distance(c, d);
+      if (delta < -kImprovementEpsilon) {
+        if (is_forward) {
+          Reverse(positions_[b], positions_[c]);
+        } else {
+          Reverse(positions_[c], positions_[b]);
+        }
+        Activate(a);
+        Activate(b);
+        Activate(c);
+        Activate(d);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Moves the segment of up to kMaxOrOptSegment vertices starting at first
+// between two neighbouring vertices c and e elsewhere in the tour
+bool LocalSearch::TryOrOpt(const int first) {
+  int n = tour_.size();
+  int last = first;
+  for (int length = 1; length <= kMaxOrOptSegment && length + 2 < n;
+       ++length, last = Next(last)) {
+    int previous = Previous(first), next = Next(last);
+    if (!HasEdge(previous, next)) {
+      continue;
+    }
+    double gain = Distance(previous, first) + Distance(last, next) -
+                  Distance(previous, next);
+    if (gain <= kImprovementEpsilon) {
+      continue;
+    }
+    auto in_segment = [this, first, length, n](int vertex) {
+      return (positions_[vertex] - positions_[first] + n) % n < length;
+    };
+    auto try_insert = [&](int c, int e) {
+      if (in_segment(c) || in_segment(e) || !HasEdge(c, first) ||
+          !HasEdge(last, e)) {
+        return false;
+      }
+      double delta = Distance(c, first) + Distance(last, e) - Distance(c, e);
+      if (delta - gain >= -kImprovementEpsilon) {
+        return false;
+      }
+      MoveSegment(first, last, c);
+      for (int vertex : {previous, next, c, e, first, last}) {
+        Activate(vertex);
+      }
+      return true;
+    };
+    for (int e : (*neighbours_)[last]) {
+      if (Distance(last, e) >= gain) {
+        break;
+      }
+      if (try_insert(Previous(e), e)) {
+        return true;
+      }
+    }
+    for (int c : (*neighbours_)[first]) {
+      if (Distance(first, c) >= gain) {
+        break;
+      }
+      if (try_insert(c, Next(c))) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Rotates whichever side of the tour between the segment and the insertion
+// point is shorter
+void LocalSearch::MoveSegment(const int first, const int last,
+                              const int after) {
+  int n = tour_.size();
+  int first_position = positions_[first];
+  int length = (positions_[last] - first_position + n) % n + 1;
+  int forward = (positions_[after] - first_position + n) % n + 1;
+  int before_position = positions_[Next(after)];
+  int backward = (first_position + length - 1 - before_position + n) % n + 1;
+  if (forward <= backward) {
+    Rotate(first_position, forward, length);
+  } else {
+    Rotate(before_position, backward, backward - length);
+  }
+}
+
+// Reverses the tour from first_position to last_position going forward,
+// or the rest of the tour when it is shorter, which is the same cycle
+void LocalSearch::Reverse(int first_position, int last_position) {
+  int n = tour_.size();
+  int length = (last_position - first_position + n) % n + 1;
+  if (2 * length > n) {
+    std::swap(first_position, last_position);
+    first_position = (first_position + 1) % n;
+    last_position = (last_position - 1 + n) % n;
+    length = n - length;
+  }
+  for (int i = 0; i < length / 2; ++i) {
+    int lhs = (first_position + i) % n, rhs = (last_position - i + n) % n;
+    std::swap(tour_[lhs], tour_[rhs]);
+    positions_[tour_[lhs]] = lhs;
+    positions_[tour_[rhs]] = rhs;
+  }
+}
+
+void LocalSearch::Rotate(const int first_position, const int length,
+                         const int shift) {
+  int n = tour_.size();
+  buffer_.resize(length);
+  for (int i = 0; i < length; ++i) {
+    buffer_[i] = tour_[(first_position + i) % n];
+  }
+  std::rotate(buffer_.begin(), buffer_.begin() + shift, buffer_.end());
+  for (int i = 0; i < length; ++i) {
+    int position = (first_position + i) % n;
+    tour_[position] = buffer_[i];
+    positions_[buffer_[i]] = position;
+  }
+}
+
+void LocalSearch::Activate(const int vertex) {
+  if (!is_queued_[vertex]) {
+    is_queued_[vertex] = 1;
+    queue_.push_back(vertex);
+  }
+}
+
+double LocalSearch::Distance(const int from, const int to) const {
+  return (*graph_)(from, to);
+}
+
+bool LocalSearch::HasEdge(const int from, const int to) const {
+  return (*graph_)(from, to) != 0;
+}
+
+int LocalSearch::Next(const int vertex) const {
+  return tour_[(positions_[vertex] + 1) % tour_.size()];
+}
+
+int LocalSearch::Previous(const int vertex) const {
+  return tour_[(positions_[vertex] + tour_.size() - 1) % tour_.size()];
+}
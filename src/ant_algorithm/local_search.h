@@ -0,0 +1,66 @@
+#ifndef ANT_ALGORITHM_LOCAL_SEARCH_H_
+#define ANT_ALGORITHM_LOCAL_SEARCH_H_
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "../matrix.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kMaxOrOptSegment = 3;
+constexpr double kImprovementEpsilon = 1e-9;
+
+// First improvement 2-opt and Or-opt on a closed tour. Moves are searched
+// only towards the nearest neighbours of a vertex and a vertex whose
+// neighbourhood gave no improvement is not looked at again until one of its
+// tour edges changes (don't-look bits). 2-opt reverses a part of the tour,
+// so it is used only on symmetric graphs; Or-opt keeps the direction of the
+// moved segment and works on both. A move never adds a missing edge.
+// One object is scratch space for one thread.
+class LocalSearch {
+ public:
+  using size_type = Matrix::size_type;
+
+ public:
+  // Methods
+  void Setup(const Matrix* graph,
+             const std::vector<std::vector<int>>* neighbours,
+             const bool is_symmetric);
+  double Improve(const std::vector<int>& tour);
+
+  // Getters
+  const std::vector<int>& GetTour() const;
+
+ private:
+  const Matrix* graph_ = nullptr;
+  const std::vector<std::vector<int>>* neighbours_ = nullptr;
+  bool is_symmetric_ = false;
+  std::vector<int> tour_;       // open tour, one position per vertex
+  std::vector<int> positions_;  // position of a vertex in tour_
+  std::vector<char> is_queued_;
+  std::deque<int> queue_;  // vertices with the don't-look bit off
+  std::vector<int> buffer_;
+
+ private:
+  bool ImproveVertex(const int vertex);
+  bool TryTwoOpt(const int vertex);
+  bool TryOrOpt(const int vertex);
+  void MoveSegment(const int first, const int last, const int after);
+  void Reverse(int first_position, int last_position);
+  void Rotate(const int first_position, const int length, const int shift);
+  void Activate(const int vertex);
+  double Distance(const int from, const int to) const;
+  bool HasEdge(const int from, const int to) const;
+  int Next(const int vertex) const;
+  int Previous(const int vertex) const;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_LOCAL_SEARCH_H_
@@ -0,0 +1,354 @@
+#include "one_tree_bound.h"
+
+using s21::ant::OneTreeBound;
+
+// Methods
+
+// The upper bound, the length of any tour, scales the subgradient steps
+double OneTreeBound::Calculate(const Matrix& graph, const double upper_bound,
+                               const int threads_quantity) {
+  size_ = graph.GetRows();
+  instance_ = nullptr;
+  if (size_ < 3) {
+    return 0;
+  }
+  weights_.resize(int64_t{size_} * size_);
+  for (size_type i = 0; i < size_; ++i) {
+    for (size_type j = 0; j < size_; ++j) {
+      double forward = graph(i, j) != 0 ? graph(i, j) : INFINITY;
+      double backward = graph(j, i) != 0 ? graph(j, i) : INFINITY;
+      weights_[int64_t{i} * size_ + j] = std::min(forward, backward);
+    }
+  }
+  double bound = RunWithWorkers(threads_quantity, [this, upper_bound]() {
+    double bound = Ascend(upper_bound, false);
+    return std::isnan(bound) ? 0 : bound;
+  });
+  weights_ = std::vector<double>();
+  return bound;
+}
+
+// A neighbour graph that does not connect the cities leaves the ascent to
+// dense 1-trees
+double OneTreeBound::Calculate(const GeometricInstance& instance,
+                               const double upper_bound,
+                               const int threads_quantity) {
+  size_ = instance.GetSize();
+  instance_ = &instance;
+  if (size_ < 3) {
+    return 0;
+  }
+  BuildCandidateGraph();
+  double bound = RunWithWorkers(threads_quantity, [this, upper_bound]() {
+    if (std::isnan(Ascend(upper_bound, true))) {
+      double bound = Ascend(upper_bound, false);
+      return std::isnan(bound) ? 0 : bound;
+    }
+    penalties_ = best_penalties_;
+    double cost = BuildDenseOneTree();
+    return std::max(0.0, cost - 2 * CalculatePenaltiesSum());
+  });
+  candidate_offsets_ = std::vector<size_type>();
+  candidates_ = std::vector<size_type>();
+  candidate_weights_ = std::vector<double>();
+  return bound;
+}
+
+// Private functions
+
+// The calling thread is worker 0 and runs the task, the others wait at the
+// barrier for each dense 1-tree it builds
+double OneTreeBound::RunWithWorkers(const int threads_quantity,
+                                    std::function<double()> task) {
+  workers_quantity_ = std::max(
+      1, std::min(threads_quantity, size_ / kMinimumBoundWorkerVertices));
+  barrier_.reset(new Barrier(workers_quantity_));
+  slices_.assign(workers_quantity_, Slice());
+  minima_.resize(2 * workers_quantity_);
+  is_finished_ = false;
+  std::vector<std::thread> workers;
+  for (int worker = 1; worker < workers_quantity_; ++worker) {
+    workers.push_back(std::thread(&OneTreeBound::Help, this, worker));
+  }
+  double result = task();
+  is_finished_ = true;
+  barrier_->Wait();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  return result;
+}
+
+void OneTreeBound::Help(const int worker) {
+  while (true) {
+    barrier_->Wait();
+    if (is_finished_) {
+      return;
+    }
+    GrowTree(worker);
+  }
+}
+
+// Penalties move towards degree 2: a vertex of a larger degree gets more
+// expensive, a leaf cheaper. The step halves when the bound stops rising.
+// Returns NaN when the edges do not connect the graph
+double OneTreeBound::Ascend(const double upper_bound, const bool is_sparse) {
+  penalties_.assign(size_, 0);
+  best_penalties_ = penalties_;
+  double best_bound = 0, step = kInitialBoundStep;
+  int stalled_steps = 0;
+  for (int iteration = 0; iteration < kBoundIterations; ++iteration) {
+    double cost = is_sparse ? BuildSparseOneTree() : BuildDenseOneTree();
+    if (std::isnan(cost)) {
+      return NAN;
+    }
+    double bound = cost - 2 * CalculatePenaltiesSum();
+    if (bound > best_bound) {
+      best_bound = bound;
+      best_penalties_ = penalties_;
+      stalled_steps = 0;
+    } else if (++stalled_steps >= kBoundStepPatience) {
+      step /= 2;
+      stalled_steps = 0;
+    }
+    double norm = 0;
+    for (int degree : degrees_) {
+      norm += (degree - 2) * (degree - 2);
+    }
+    if (norm == 0 || step < kMinimumBoundStep || bound >= upper_bound) {
+      break;
+    }
+    double step_size = step * (upper_bound - bound) / norm;
+    for (size_type vertex = 0; vertex < size_; ++vertex) {
+      penalties_[vertex] += step_size * (degrees_[vertex] - 2);
+    }
+  }
+  return best_bound;
+}
+
+// Prim over all vertices but the special one, vertex 0, which then joins
+// through its two cheapest edges
+double OneTreeBound::BuildDenseOneTree() {
+  degrees_.assign(size_, 0);
+  tree_cost_ = 0;
+  is_disconnected_ = false;
+  barrier_->Wait();
+  GrowTree(0);
+  if (is_disconnected_) {
+    return NAN;
+  }
+  std::vector<size_type> vertices(size_ - 1);
+  std::vector<double> weights(size_ - 1);
+  for (size_type vertex = 1; vertex < size_; ++vertex) {
+    vertices[vertex - 1] = vertex;
+  }
+  FillRow(0, vertices.data(), size_ - 1, weights.data());
+  for (size_type i = 0; i < size_ - 1; ++i) {
+    weights[i] += penalties_[vertices[i]];
+  }
+  return JoinSpecialVertex(vertices.data(), weights.data(), size_ - 1);
+}
+
+// Run by every worker on its own slice. Each worker keeps its vertices
+// outside the tree in a compact list and publishes the lightest of them; all
+// workers pick the same next vertex from these minima, its owner removes it,
+// and the pass that lowers the keys also finds the new minimum. The minima
+// alternate between two rounds, so the next round is written while the
+// current one is still read
+void OneTreeBound::GrowTree(const int worker) {
+  Slice& slice = slices_[worker];
+  size_type first = std::max<int64_t>(
+      1, int64_t{size_} * worker / workers_quantity_);
+  size_type last = int64_t{size_} * (worker + 1) / workers_quantity_;
+  slice.vertices.clear();
+  for (size_type vertex = first; vertex < last; ++vertex) {
+    slice.vertices.push_back(vertex);
+  }
+  size_type quantity = slice.vertices.size();
+  slice.keys.assign(quantity, INFINITY);
+  slice.parents.assign(quantity, -1);
+  slice.row.resize(quantity);
+  Minimum minimum{INFINITY, -1, -1, -1};
+  if (quantity > 0 && slice.vertices[0] == 1) {
+    slice.keys[0] = 0;
+    minimum = Minimum{0, 1, -1, 0};
+  }
+  minima_[worker] = minimum;
+  barrier_->Wait();
+  for (size_type step = 0; step < size_ - 1; ++step) {
+    const Minimum* current = &minima_[(step % 2) * workers_quantity_];
+    int owner = 0;
+    for (int i = 1; i < workers_quantity_; ++i) {
+      owner = current[i].key < current[owner].key ? i : owner;
+    }
+    Minimum added = current[owner];
+    if (added.key == INFINITY) {
+      if (worker == 0) {
+        is_disconnected_ = true;
+      }
+      return;
+    }
+    if (worker == 0) {
+      tree_cost_ += added.key;
+      if (added.parent != -1) {
+        ++degrees_[added.vertex];
+        ++degrees_[added.parent];
+      }
+    }
+    if (worker == owner) {
+      --quantity;
+      slice.vertices[added.position] = slice.vertices[quantity];
+      slice.keys[added.position] = slice.keys[quantity];
+      slice.parents[added.position] = slice.parents[quantity];
+      slice.vertices.pop_back();
+    }
+    FillRow(added.vertex, slice.vertices.data(), quantity, slice.row.data());
+    double penalty = penalties_[added.vertex];
+    minimum = Minimum{INFINITY, -1, -1, -1};
+    for (size_type i = 0; i < quantity; ++i) {
+      double weight = slice.row[i] + penalty + penalties_[slice.vertices[i]];
+      if (weight < slice.keys[i]) {
+        slice.keys[i] = weight;
+        slice.parents[i] = added.vertex;
+      }
+      if (slice.keys[i] < minimum.key) {
+        minimum =
+            Minimum{slice.keys[i], slice.vertices[i], slice.parents[i], i};
+      }
+    }
+    minima_[((step + 1) % 2) * workers_quantity_ + worker] = minimum;
+    barrier_->Wait();
+  }
+}
+
+// Prim with a heap over the neighbour graph, whose keys go stale instead of
+// being decreased
+double OneTreeBound::BuildSparseOneTree() {
+  using entry_type = std::pair<double, size_type>;
+  degrees_.assign(size_, 0);
+  tree_cost_ = 0;
+  std::vector<double> keys(size_, INFINITY);
+  std::vector<size_type> parents(size_, -1);
+  std::vector<char> is_in_tree(size_, false);
+  std::priority_queue<entry_type, std::vector<entry_type>,
+                      std::greater<entry_type>>
+      queue;
+  is_in_tree[0] = true;
+  keys[1] = 0;
+  queue.push(entry_type(0, 1));
+  size_type tree_size = 0;
+  while (!queue.empty()) {
+    entry_type top = queue.top();
+    queue.pop();
+    size_type vertex = top.second;
+    if (is_in_tree[vertex] || top.first > keys[vertex]) {
+      continue;
+    }
+    is_in_tree[vertex] = true;
+    ++tree_size;
+    tree_cost_ += top.first;
+    if (parents[vertex] != -1) {
+      ++degrees_[vertex];
+      ++degrees_[parents[vertex]];
+    }
+    for (size_type k = candidate_offsets_[vertex];
+         k < candidate_offsets_[vertex + 1]; ++k) {
+      size_type neighbour = candidates_[k];
+      double weight = candidate_weights_[k] + penalties_[vertex] +
+                      penalties_[neighbour];
+      if (!is_in_tree[neighbour] && weight < keys[neighbour]) {
+        keys[neighbour] = weight;
+        parents[neighbour] = vertex;
+        queue.push(entry_type(weight, neighbour));
+      }
+    }
+  }
+  if (tree_size < size_ - 1) {
+    return NAN;
+  }
+  size_type first = candidate_offsets_[0];
+  size_type quantity = candidate_offsets_[1] - first;
+  std::vector<double> weights(quantity);
+  for (size_type i = 0; i < quantity; ++i) {
+    weights[i] =
+        candidate_weights_[first + i] + penalties_[candidates_[first + i]];
+  }
+  return JoinSpecialVertex(&candidates_[first], weights.data(), quantity);
+}
+
+// Weights already carry the penalties of the vertices, not the special one's
+double OneTreeBound::JoinSpecialVertex(const size_type* vertices,
+                                       const double* weights,
+                                       const size_type quantity) {
+  size_type first = -1, second = -1;
+  double first_weight = INFINITY, second_weight = INFINITY;
+  for (size_type i = 0; i < quantity; ++i) {
+    if (first == -1 || weights[i] < first_weight) {
+      second = first;
+      second_weight = first_weight;
+      first = vertices[i];
+      first_weight = weights[i];
+    } else if (second == -1 || weights[i] < second_weight) {
+      second = vertices[i];
+      second_weight = weights[i];
+    }
+  }
+  if (second_weight == INFINITY) {
+    return NAN;
+  }
+  ++degrees_[first];
+  ++degrees_[second];
+  degrees_[0] = 2;
+  return tree_cost_ + first_weight + second_weight + 2 * penalties_[0];
+}
+
+// Nearest neighbour lists made symmetric, a city lists whoever lists it
+void OneTreeBound::BuildCandidateGraph() {
+  size_type quantity = std::min(kBoundCandidatesQuantity, size_ - 1);
+  std::vector<size_type> nearest = instance_->FindNearestNeighbours(quantity);
+  std::vector<std::vector<size_type>> adjacency(size_);
+  for (size_type vertex = 0; vertex < size_; ++vertex) {
+    for (size_type k = 0; k < quantity; ++k) {
+      size_type neighbour = nearest[int64_t{vertex} * quantity + k];
+      adjacency[vertex].push_back(neighbour);
+      adjacency[neighbour].push_back(vertex);
+    }
+  }
+  candidate_offsets_.assign(1, 0);
+  candidates_.clear();
+  candidate_weights_.clear();
+  for (size_type vertex = 0; vertex < size_; ++vertex) {
+    std::vector<size_type>& neighbours = adjacency[vertex];
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()),
+                     neighbours.end());
+    for (size_type neighbour : neighbours) {
+      candidates_.push_back(neighbour);
+      candidate_weights_.push_back(instance_->Distance(vertex, neighbour));
+    }
+    candidate_offsets_.push_back(candidates_.size());
+    neighbours = std::vector<size_type>();
+  }
+}
+
+double OneTreeBound::CalculatePenaltiesSum() const {
+  double penalties_sum = 0;
+  for (double penalty : penalties_) {
+    penalties_sum += penalty;
+  }
+  return penalties_sum;
+}
+
+// Weights from a vertex to a list of vertices, gathered from the matrix
+// graph or computed for a coordinate instance
+void OneTreeBound::FillRow(const size_type vertex, const size_type* vertices,
+                           const size_type quantity, double* row) const {
+  if (instance_ == nullptr) {
+    const double* weights = &weights_[int64_t{vertex} * size_];
+    for (size_type i = 0; i < quantity; ++i) {
+      row[i] = weights[vertices[i]];
+    }
+    return;
+  }
+  instance_->Distances(vertex, vertices, quantity, row);
+}
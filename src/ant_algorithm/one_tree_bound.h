@@ -0,0 +1,101 @@
+#ifndef ANT_ALGORITHM_ONE_TREE_BOUND_H_
+#define ANT_ALGORITHM_ONE_TREE_BOUND_H_
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../matrix.h"
+#include "barrier.h"
+#include "geometric_instance.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kBoundIterations = 100;  // subgradient steps
+constexpr double kInitialBoundStep = 2;
+constexpr double kMinimumBoundStep = 1e-3;
+constexpr int kBoundStepPatience = 5;  // steps without a rise before halving
+constexpr int kBoundCandidatesQuantity = 10;  // nearest cities per city
+constexpr int kMinimumBoundWorkerVertices = 2048;  // of a Prim scan slice
+
+// Held-Karp lower bound on the length of a tour: a minimum 1-tree, a
+// spanning tree of all vertices but a special one plus its two cheapest
+// edges, under vertex penalties raised by subgradient ascent. An asymmetric
+// graph is bounded through min(d_ij, d_ji), and a graph whose edges do not
+// connect it gets the bound 0.
+//
+// A matrix graph ascends on dense 1-trees: Prim runs in O(n^2) per step and
+// its key updates are split between workers, each owning a slice of the
+// vertices, which live for the whole ascent and meet at a barrier after
+// every added vertex. A coordinate instance ascends on the 1-trees of its
+// nearest neighbour graph, O(n * k log n) per step, and only the final bound
+// is taken from one dense 1-tree under the best penalties, since a tree of a
+// subgraph may be longer than the minimum one. Dense rows are computed one at
+// a time instead of being stored.
+class OneTreeBound {
+ public:
+  using size_type = int;
+
+ public:
+  // Methods
+  double Calculate(const Matrix& graph, const double upper_bound,
+                   const int threads_quantity);
+  double Calculate(const GeometricInstance& instance, const double upper_bound,
+                   const int threads_quantity);
+
+ private:
+  // The lightest edge from a worker's slice into the tree
+  struct Minimum {
+    double key;
+    size_type vertex, parent, position;
+  };
+
+  // The vertices of a worker's slice outside the tree
+  struct Slice {
+    std::vector<size_type> vertices, parents;
+    std::vector<double> keys, row;
+  };
+
+  size_type size_ = 0;
+  std::vector<double> weights_;  // symmetric, of a matrix graph
+  const GeometricInstance* instance_ = nullptr;
+  std::vector<size_type> candidate_offsets_, candidates_;  // symmetric
+  std::vector<double> candidate_weights_;
+  std::vector<double> penalties_, best_penalties_;
+  std::vector<int> degrees_;
+  int workers_quantity_ = 1;
+  std::unique_ptr<Barrier> barrier_;
+  bool is_finished_ = false;
+  std::vector<Slice> slices_;
+  std::vector<Minimum> minima_;  // two rounds of one per worker
+  double tree_cost_ = 0;
+  bool is_disconnected_ = false;
+
+ private:
+  double RunWithWorkers(const int threads_quantity,
+                        std::function<double()> task);
+  void Help(const int worker);
+  double Ascend(const double upper_bound, const bool is_sparse);
+  double BuildDenseOneTree();
+  void GrowTree(const int worker);
+  double BuildSparseOneTree();
+  double JoinSpecialVertex(const size_type* vertices, const double* weights,
+                           const size_type quantity);
+  void BuildCandidateGraph();
+  double CalculatePenaltiesSum() const;
+  void FillRow(const size_type vertex, const size_type* vertices,
+               const size_type quantity, double* row) const;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_ONE_TREE_BOUND_H_
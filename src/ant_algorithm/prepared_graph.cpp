@@ -0,0 +1,220 @@
+#include "prepared_graph.h"
+
+using s21::ant::PreparedGraph;
+
+// Constructors
+PreparedGraph::PreparedGraph(const Matrix& graph,
+                             const int candidates_quantity)
+    : graph_(graph), candidates_quantity_(std::max(1, candidates_quantity)) {
+  Validate();
+  SetupCandidates();
+  SetupHeuristic();
+  nearest_neighbour_distance_ = CalculateNearestNeighbourDistance();
+}
+
+// The weights are copied once, every change then updates the statistics of
+// its edge, and only the changed rows sort their neighbours again
+PreparedGraph::PreparedGraph(const PreparedGraph& previous,
+                             const std::vector<EdgeChange>& changes)
+    : graph_(previous.graph_),
+      heuristic_(previous.heuristic_),
+      candidates_(previous.candidates_),
+      degrees_(previous.degrees_),
+      incoming_degrees_(previous.incoming_degrees_),
+      candidates_quantity_(previous.candidates_quantity_),
+      mean_weight_(previous.mean_weight_),
+      asymmetric_entries_(previous.asymmetric_entries_) {
+  size_type size = graph_.GetRows();
+  std::vector<bool> changed_rows(size, false);
+  for (const EdgeChange& change : changes) {
+    if (change.from < 0 || change.from >= size || change.to < 0 ||
+        change.to >= size || change.from == change.to || change.weight < 0) {
+      throw s21::InvalidEdgeChange();
+    }
+    ApplyChange(change);
+    changed_rows[change.from] = true;
+  }
+  is_symmetric_ = asymmetric_entries_ == 0;
+  for (size_type vertex = 0; vertex < size; ++vertex) {
+    if (!changed_rows[vertex]) {
+      continue;
+    }
+    SetupCandidates(vertex);
+  }
+  for (const EdgeChange& change : changes) {
+    if (degrees_[change.from] + incoming_degrees_[change.from] == 0 ||
+        degrees_[change.to] + incoming_degrees_[change.to] == 0) {
+      throw s21::DisconnectedGraph();
+    }
+  }
+  nearest_neighbour_distance_ = CalculateNearestNeighbourDistance();
+}
+
+// Methods
+bool PreparedGraph::IsPreparedFor(const Matrix& graph,
+                                  const int candidates_quantity) const {
+  if (std::max(1, candidates_quantity) != candidates_quantity_ ||
+      graph.GetRows() != graph_.GetRows() ||
+      graph.GetColumns() != graph_.GetColumns()) {
+    return false;
+  }
+  for (size_type i = 0; i < graph_.GetRows(); ++i) {
+    for (size_type j = 0; j < graph_.GetColumns(); ++j) {
+      if (graph(i, j) != graph_(i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Getters
+const s21::Matrix& PreparedGraph::GetGraph() const { return graph_; }
+
+const s21::Matrix& PreparedGraph::GetHeuristic() const { return heuristic_; }
+
+const std::vector<std::vector<int>>& PreparedGraph::GetCandidates() const {
+  return candidates_;
+}
+
+typename PreparedGraph::size_type PreparedGraph::GetSize() const {
+  return graph_.GetRows();
+}
+
+int PreparedGraph::GetCandidatesQuantity() const {
+  return candidates_quantity_;
+}
+
+int PreparedGraph::GetDegree(const size_type vertex) const {
+  return degrees_[vertex];
+}
+
+double PreparedGraph::GetMeanWeight() const { return mean_weight_; }
+
+double PreparedGraph::GetNearestNeighbourDistance() const {
+  return nearest_neighbour_distance_;
+}
+
+// Safe to call from several colonies at once, the others wait for the
+// first one
+double PreparedGraph::GetLowerBound(const int threads_quantity) const {
+  std::call_once(lower_bound_flag_, [this, threads_quantity]() {
+    lower_bound_ = OneTreeBound().Calculate(
+        graph_, nearest_neighbour_distance_, threads_quantity);
+  });
+  return lower_bound_;
+}
+
+bool PreparedGraph::IsSymmetric() const { return is_symmetric_; }
+
+// Private functions
+
+// One pass over the weights counts the edges of every vertex in both
+// directions, a vertex without any is isolated
+void PreparedGraph::Validate() {
+  size_type size = graph_.GetRows();
+  incoming_degrees_.assign(size, 0);
+  degrees_.assign(size, 0);
+  mean_weight_ = 0;
+  asymmetric_entries_ = 0;
+  for (size_type i = 0; i < size; ++i) {
+    for (size_type j = 0; j < graph_.GetColumns(); ++j) {
+      mean_weight_ += graph_(i, j);
+      if (i != j && HasEdge(i, j)) {
+        ++degrees_[i];
+        ++incoming_degrees_[j];
+      }
+      asymmetric_entries_ += graph_(i, j) != graph_(j, i);
+    }
+  }
+  is_symmetric_ = asymmetric_entries_ == 0;
+  mean_weight_ /= size * graph_.GetColumns();
+  for (size_type vertex = 0; vertex < size; ++vertex) {
+    if (degrees_[vertex] == 0 && incoming_degrees_[vertex] == 0) {
+      throw s21::DisconnectedGraph();
+    }
+  }
+}
+
+// The entries (i, j) and (j, i) are compared before and after the change,
+// both directions count towards the asymmetric entries
+void PreparedGraph::ApplyChange(const EdgeChange& change) {
+  size_type from = change.from, to = change.to;
+  bool had_edge = HasEdge(from, to);
+  bool was_asymmetric = graph_(from, to) != graph_(to, from);
+  size_type size = graph_.GetRows();
+  mean_weight_ += (change.weight - graph_(from, to)) / (size * size);
+  graph_(from, to) = change.weight;
+  bool has_edge = HasEdge(from, to);
+  bool is_asymmetric = graph_(from, to) != graph_(to, from);
+  asymmetric_entries_ += 2 * (int64_t{is_asymmetric} - was_asymmetric);
+  degrees_[from] += has_edge - had_edge;
+  incoming_degrees_[to] += has_edge - had_edge;
+  heuristic_(from, to) = has_edge ? 1 / change.weight : 0;
+}
+
+// Keeps for every vertex its candidates_quantity_ nearest neighbours
+void PreparedGraph::SetupCandidates() {
+  candidates_.assign(graph_.GetRows(), std::vector<int>());
+  for (size_type i = 0; i < graph_.GetRows(); ++i) {
+    SetupCandidates(i);
+  }
+}
+
+void PreparedGraph::SetupCandidates(const size_type vertex) {
+  std::vector<int> neighbours;
+  for (size_type j = 0; j < graph_.GetColumns(); ++j) {
+    if (vertex != j && HasEdge(vertex, j)) {
+      neighbours.push_back(j);
+    }
+  }
+  int quantity = std::min<int>(candidates_quantity_, neighbours.size());
+  std::partial_sort(neighbours.begin(), neighbours.begin() + quantity,
+                    neighbours.end(), [this, vertex](int lhs, int rhs) {
+                      return graph_(vertex, lhs) < graph_(vertex, rhs);
+                    });
+  candidates_[vertex].assign(neighbours.begin(), neighbours.begin() + quantity);
+}
+
+void PreparedGraph::SetupHeuristic() {
+  heuristic_.Resize(graph_.GetRows(), graph_.GetColumns());
+  for (size_type i = 0; i < graph_.GetRows(); ++i) {
+    for (size_type j = 0; j < graph_.GetColumns(); ++j) {
+      heuristic_(i, j) = HasEdge(i, j) ? 1 / graph_(i, j) : 0;
+    }
+  }
+}
+
+// Greedy tour from vertex 0. A dead end in an incomplete graph falls back
+// to the mean weight of an edge times the vertices quantity
+double PreparedGraph::CalculateNearestNeighbourDistance() const {
+  size_type vertices_quantity = graph_.GetRows();
+  std::vector<bool> visited(vertices_quantity, false);
+  double distance = 0;
+  int current_vertex = 0;
+  visited[current_vertex] = true;
+  for (size_type step = 1; step < vertices_quantity; ++step) {
+    int next_vertex = -1;
+    for (size_type vertex = 0; vertex < vertices_quantity; ++vertex) {
+      if (!visited[vertex] && HasEdge(current_vertex, vertex) &&
+          (next_vertex == -1 || graph_(current_vertex, vertex) <
+                                    graph_(current_vertex, next_vertex))) {
+        next_vertex = vertex;
+      }
+    }
+    if (next_vertex == -1) {
+      return mean_weight_ * vertices_quantity;
+    }
+    visited[next_vertex] = true;
+    distance += graph_(current_vertex, next_vertex);
+    current_vertex = next_vertex;
+  }
+  if (HasEdge(current_vertex, 0)) {
+    distance += graph_(current_vertex, 0);
+  }
+  return distance;
+}
+
+bool PreparedGraph::HasEdge(const size_type from, const size_type to) const {
+  return graph_(from, to) != kDefaultCost;
+}
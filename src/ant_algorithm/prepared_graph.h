@@ -0,0 +1,88 @@
+#ifndef ANT_ALGORITHM_PREPARED_GRAPH_H_
+#define ANT_ALGORITHM_PREPARED_GRAPH_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+#include "one_tree_bound.h"
+
+namespace s21 {
+
+namespace ant {
+
+constexpr int kDefaultCost = 0;  // weight of a missing edge
+constexpr int kDefaultCandidatesQuantity = 20;
+
+// A new weight of one directed edge, kDefaultCost removes the edge
+struct EdgeChange {
+  int from;
+  int to;
+  double weight;
+};
+
+// A graph validated once, with everything a colony derives from the weights
+// alone: the heuristic, the nearest neighbours, degrees, mean weight,
+// symmetry and the length of a nearest neighbour tour. It is built in
+// O(n^2 log k) and never changes, so one object can be shared by the
+// iterations and repeated solves of a colony and by the colonies of an
+// island model. The lower bound is computed by the first solve that asks
+// for it. A graph with changed edges is derived from the previous one,
+// only the rows of the changed edges get new candidates.
+class PreparedGraph {
+ public:
+  using size_type = Matrix::size_type;
+
+ public:
+  // Constructors
+  PreparedGraph(const Matrix& graph, const int candidates_quantity);
+  PreparedGraph(const PreparedGraph& previous,
+                const std::vector<EdgeChange>& changes);
+
+  // Methods
+  bool IsPreparedFor(const Matrix& graph, const int candidates_quantity) const;
+
+  // Getters
+  const Matrix& GetGraph() const;
+  const Matrix& GetHeuristic() const;  // 1 / distance, 0 without an edge
+  const std::vector<std::vector<int>>& GetCandidates() const;
+  size_type GetSize() const;
+  int GetCandidatesQuantity() const;
+  int GetDegree(const size_type vertex) const;  // of the outgoing edges
+  double GetMeanWeight() const;  // over all n^2 entries
+  double GetNearestNeighbourDistance() const;
+  double GetLowerBound(const int threads_quantity) const;
+  bool IsSymmetric() const;
+
+ private:
+  Matrix graph_;
+  Matrix heuristic_;
+  std::vector<std::vector<int>> candidates_;  // nearest neighbours per vertex
+  std::vector<int> degrees_;
+  std::vector<int> incoming_degrees_;
+  int candidates_quantity_;
+  double mean_weight_ = 0;
+  int64_t asymmetric_entries_ = 0;  // (i, j) with d_ij != d_ji
+  double nearest_neighbour_distance_ = 0;
+  bool is_symmetric_ = true;
+  mutable std::once_flag lower_bound_flag_;
+  mutable double lower_bound_ = 0;
+
+ private:
+  void Validate();
+  void ApplyChange(const EdgeChange& change);
+  void SetupCandidates();
+  void SetupCandidates(const size_type vertex);
+  void SetupHeuristic();
+  double CalculateNearestNeighbourDistance() const;
+  bool HasEdge(const size_type from, const size_type to) const;
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_PREPARED_GRAPH_H_
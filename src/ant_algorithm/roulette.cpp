@@ -0,0 +1,158 @@
+#include "roulette.h"
+
+#include <algorithm>
+
+using s21::ant::AliasTables;
+using s21::ant::Roulette;
+
+// Methods
+void Roulette::GatherByVertex(const double* weights, const int* vertices,
+                              const int quantity, const uint64_t* visited) {
+  Prepare(vertices, quantity, visited);
+  for (int i = 0; i < quantity_; ++i) {
+    weights_[i] *= weights[vertices_[i]];
+  }
+  Accumulate();
+}
+
+// The weights are a row laid out in the order of vertices, as the rows of
+// candidate edges are
+void Roulette::GatherByPosition(const double* weights, const int* vertices,
+                                const int quantity, const uint64_t* visited) {
+  Prepare(vertices, quantity, visited);
+  for (int i = 0; i < quantity_; ++i) {
+    weights_[i] *= weights[i];
+  }
+  Accumulate();
+}
+
+int Roulette::Select(const double random_number) const {
+  return vertices_[SelectPosition(random_number)];
+}
+
+// The first prefix sum above the random point. A rounded point equal to the
+// total falls on the last positive weight
+int Roulette::SelectPosition(const double random_number) const {
+  const double* prefix_sums = prefix_sums_.data();
+  double random_point = random_number * prefix_sums[quantity_ - 1];
+  const double* base = prefix_sums;
+  int length = quantity_;
+  while (length > 1) {
+    int half = length / 2;
+    base = base[half - 1] <= random_point ? base + half : base;
+    length -= half;
+  }
+  int index = static_cast<int>(base - prefix_sums) + (*base <= random_point);
+  return std::min(index, last_);
+}
+
+bool Roulette::IsEmpty() const {
+  return quantity_ == 0 || !(prefix_sums_[quantity_ - 1] > 0);
+}
+
+// Getters
+int Roulette::GetBest() const { return vertices_[GetBestPosition()]; }
+
+int Roulette::GetBestPosition() const {
+  int best = 0;
+  for (int i = 1; i < quantity_; ++i) {
+    best = weights_[i] > weights_[best] ? i : best;
+  }
+  return best;
+}
+
+// Private functions
+void Roulette::Prepare(const int* vertices, const int quantity,
+                       const uint64_t* visited) {
+  quantity_ = quantity;
+  if (static_cast<int>(vertices_.size()) < quantity) {
+    vertices_.resize(quantity);
+    weights_.resize(quantity);
+    prefix_sums_.resize(quantity);
+  }
+  for (int i = 0; i < quantity; ++i) {
+    int vertex = vertices[i];
+    uint64_t is_visited = (visited[vertex >> 6] >> (vertex & 63)) & 1;
+    vertices_[i] = vertex;
+    weights_[i] = static_cast<double>(1 - is_visited);
+  }
+}
+
+void Roulette::Accumulate() {
+  double total = 0;
+  int last = 0;
+  for (int i = 0; i < quantity_; ++i) {
+    total += weights_[i];
+    prefix_sums_[i] = total;
+    last = weights_[i] > 0 ? i : last;
+  }
+  last_ = last;
+}
+
+// Methods
+void AliasTables::Resize(const int rows, const int columns) {
+  columns_ = columns;
+  probabilities_.assign(int64_t{rows} * columns, 0);
+  aliases_.assign(int64_t{rows} * columns, 0);
+  quantities_.assign(rows, 0);
+}
+
+// Positions below the mean weight are paired with one above it, which gives
+// away the rest of its column. A row without weight is never accepted
+void AliasTables::Build(const int row, const double* weights,
+                        const int quantity) {
+  double* probabilities = &probabilities_[int64_t{row} * columns_];
+  int* aliases = &aliases_[int64_t{row} * columns_];
+  quantities_[row] = quantity;
+  double total = 0;
+  for (int i = 0; i < quantity; ++i) {
+    total += weights[i];
+  }
+  if (!(total > 0)) {
+    for (int i = 0; i < quantity; ++i) {
+      probabilities[i] = 0;
+      aliases[i] = i;
+    }
+    return;
+  }
+  // Small positions are stacked from the front and large ones from the back
+  std::vector<int> stack(quantity);
+  int small = 0, large = quantity;
+  for (int i = 0; i < quantity; ++i) {
+    probabilities[i] = weights[i] * quantity / total;
+    aliases[i] = i;
+    if (probabilities[i] < 1) {
+      stack[small++] = i;
+    } else {
+      stack[--large] = i;
+    }
+  }
+  while (small > 0 && large < quantity) {
+    int less = stack[--small], more = stack[large++];
+    aliases[less] = more;
+    probabilities[more] += probabilities[less] - 1;
+    if (probabilities[more] < 1) {
+      stack[small++] = more;
+    } else {
+      stack[--large] = more;
+    }
+  }
+  while (large < quantity) {
+    probabilities[stack[large++]] = 1;
+  }
+  while (small > 0) {
+    probabilities[stack[--small]] = 1;
+  }
+}
+
+// Returns -1 for an empty row
+int AliasTables::Sample(const int row, const double random_number) const {
+  int quantity = quantities_[row];
+  if (quantity == 0) {
+    return -1;
+  }
+  double point = random_number * quantity;
+  int column = std::min(static_cast<int>(point), quantity - 1);
+  int64_t index = int64_t{row} * columns_ + column;
+  return point - column < probabilities_[index] ? column : aliases_[index];
+}
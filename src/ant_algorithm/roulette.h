@@ -0,0 +1,66 @@
+#ifndef ANT_ALGORITHM_ROULETTE_H_
+#define ANT_ALGORITHM_ROULETTE_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace s21 {
+
+namespace ant {
+
+// Roulette wheel over one row of transition weights. Gather copies the
+// weights of the row into a contiguous array, zeroing visited vertices with
+// a mask instead of a branch, so the loops stay free of data dependent jumps
+// and the compiler may vectorize them. Select draws with a branch-free
+// binary search over the prefix sums, a zero weight is never drawn
+class Roulette {
+ public:
+  // Methods
+  void GatherByVertex(const double* weights, const int* vertices,
+                      const int quantity, const uint64_t* visited);
+  void GatherByPosition(const double* weights, const int* vertices,
+                        const int quantity, const uint64_t* visited);
+  int Select(const double random_number) const;  // in [0, 1)
+  int SelectPosition(const double random_number) const;
+  bool IsEmpty() const;
+
+  // Getters
+  int GetBest() const;  // vertex of the largest weight
+  int GetBestPosition() const;
+
+ private:
+  std::vector<int> vertices_;
+  std::vector<double> weights_;
+  std::vector<double> prefix_sums_;
+  int quantity_ = 0;
+  int last_ = 0;  // index of the last positive weight
+
+ private:
+  void Prepare(const int* vertices, const int quantity,
+               const uint64_t* visited);
+  void Accumulate();
+};
+
+// Vose alias tables, one per row of candidates. A row is built in O(k)
+// after the weights change and then sampled in O(1) as many times as
+// needed. Visited vertices are not masked, the caller rejects them and
+// draws again, which keeps the distribution over the unvisited ones
+class AliasTables {
+ public:
+  // Methods
+  void Resize(const int rows, const int columns);
+  void Build(const int row, const double* weights, const int quantity);
+  int Sample(const int row, const double random_number) const;  // position
+
+ private:
+  int columns_ = 0;
+  std::vector<double> probabilities_;
+  std::vector<int> aliases_;
+  std::vector<int> quantities_;  // per row
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_ROULETTE_H_
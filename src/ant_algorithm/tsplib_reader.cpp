@@ -0,0 +1,145 @@
+#include "tsplib_reader.h"
+
+using s21::ant::TsplibReader;
+
+// Methods
+s21::ant::TsplibInstance TsplibReader::Read(const std::string& path) {
+  std::ifstream input(path);
+  if (!input.is_open()) {
+    throw s21::TsplibInputFailure();
+  }
+  return Read(input);
+}
+
+// Keyword lines come before the data sections. Sections that do not
+// describe the weights, like DISPLAY_DATA_SECTION, are skipped
+s21::ant::TsplibInstance TsplibReader::Read(std::istream& input) {
+  specification_.clear();
+  dimension_ = 0;
+  TsplibInstance instance;
+  bool has_weights = false;
+  std::string line;
+  while (std::getline(input, line)) {
+    line = Trim(line);
+    if (line == "EOF") {
+      break;
+    }
+    if (line.find(':') != std::string::npos) {
+      ReadSpecification(line);
+    } else if (line == "NODE_COORD_SECTION") {
+      ReadCoordinates(input, &instance);
+      has_weights = true;
+    } else if (line == "EDGE_WEIGHT_SECTION") {
+      ReadWeights(input, &instance);
+      has_weights = true;
+    }
+  }
+  if (!has_weights) {
+    throw s21::TsplibInputFailure();
+  }
+  instance.name = GetValue("NAME");
+  return instance;
+}
+
+// Private functions
+void TsplibReader::ReadSpecification(const std::string& line) {
+  size_t separator = line.find(':');
+  std::string key = Trim(line.substr(0, separator));
+  std::string value = Trim(line.substr(separator + 1));
+  specification_[key] = value;
+  if (key == "TYPE" && value != "TSP" && value != "ATSP") {
+    throw s21::TsplibInputFailure();
+  }
+  if (key == "DIMENSION") {
+    std::istringstream stream(value);
+    if (!(stream >> dimension_) || dimension_ < 2) {
+      throw s21::TsplibInputFailure();
+    }
+  }
+}
+
+void TsplibReader::ReadCoordinates(std::istream& input,
+                                   TsplibInstance* instance) {
+  std::map<std::string, EdgeWeightType> types = {
+      {"EUC_2D", EdgeWeightType::kEuclidean2d},
+      {"GEO", EdgeWeightType::kGeographical},
+      {"ATT", EdgeWeightType::kPseudoEuclidean}};
+  std::map<std::string, EdgeWeightType>::iterator type =
+      types.find(GetValue("EDGE_WEIGHT_TYPE"));
+  if (type == types.end() || dimension_ == 0) {
+    throw s21::TsplibInputFailure();
+  }
+  std::vector<double> x(dimension_), y(dimension_);
+  std::vector<char> is_read(dimension_, 0);
+  for (int i = 0; i < dimension_; ++i) {
+    int id = 0;
+    double x_coordinate = 0, y_coordinate = 0;
+    if (!(input >> id >> x_coordinate >> y_coordinate) || id < 1 ||
+        id > dimension_ || is_read[id - 1]) {
+      throw s21::TsplibInputFailure();
+    }
+    is_read[id - 1] = 1;
+    x[id - 1] = x_coordinate;
+    y[id - 1] = y_coordinate;
+  }
+  instance->geometric = GeometricInstance(type->second, x, y);
+  instance->is_explicit = false;
+}
+
+// Column formats of a symmetric matrix list the same values as the
+// opposite row formats
+void TsplibReader::ReadWeights(std::istream& input, TsplibInstance* instance) {
+  std::map<std::string, std::string> formats = {
+      {"FULL_MATRIX", "FULL_MATRIX"},
+      {"UPPER_ROW", "UPPER_ROW"},
+      {"LOWER_ROW", "LOWER_ROW"},
+      {"UPPER_DIAG_ROW", "UPPER_DIAG_ROW"},
+      {"LOWER_DIAG_ROW", "LOWER_DIAG_ROW"},
+      {"UPPER_COL", "LOWER_ROW"},
+      {"LOWER_COL", "UPPER_ROW"},
+      {"UPPER_DIAG_COL", "LOWER_DIAG_ROW"},
+      {"LOWER_DIAG_COL", "UPPER_DIAG_ROW"}};
+  std::map<std::string, std::string>::iterator format =
+      formats.find(GetValue("EDGE_WEIGHT_FORMAT"));
+  if (GetValue("EDGE_WEIGHT_TYPE") != "EXPLICIT" || format == formats.end() ||
+      dimension_ == 0) {
+    throw s21::TsplibInputFailure();
+  }
+  const std::string& layout = format->second;
+  bool is_full = layout == "FULL_MATRIX";
+  bool is_upper = layout.find("UPPER") == 0;
+  bool has_diagonal = layout.find("DIAG") != std::string::npos;
+  Matrix& matrix = instance->matrix;
+  matrix.Resize(dimension_, dimension_);
+  for (int i = 0; i < dimension_; ++i) {
+    int first = is_full || !is_upper ? 0 : (has_diagonal ? i : i + 1);
+    int last = is_full || is_upper ? dimension_ : (has_diagonal ? i + 1 : i);
+    for (int j = first; j < last; ++j) {
+      double weight = 0;
+      if (!(input >> weight)) {
+        throw s21::TsplibInputFailure();
+      }
+      matrix(i, j) = weight;
+      if (!is_full) {
+        matrix(j, i) = weight;
+      }
+    }
+    matrix(i, i) = 0;
+  }
+  instance->is_explicit = true;
+}
+
+std::string TsplibReader::GetValue(const std::string& key) const {
+  std::map<std::string, std::string>::const_iterator value =
+      specification_.find(key);
+  return value == specification_.end() ? std::string() : value->second;
+}
+
+std::string TsplibReader::Trim(const std::string& str) {
+  size_t first = str.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) {
+    return std::string();
+  }
+  size_t last = str.find_last_not_of(" \t\r\n");
+  return str.substr(first, last - first + 1);
+}
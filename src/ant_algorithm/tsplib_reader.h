@@ -0,0 +1,53 @@
+#ifndef ANT_ALGORITHM_TSPLIB_READER_H_
+#define ANT_ALGORITHM_TSPLIB_READER_H_
+
+#include <fstream>
+#include <istream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+#include "geometric_instance.h"
+
+namespace s21 {
+
+namespace ant {
+
+// A coordinate instance keeps its cities in geometric, an EXPLICIT one its
+// weights in matrix
+struct TsplibInstance {
+  std::string name;
+  bool is_explicit{false};
+  GeometricInstance geometric;
+  Matrix matrix;
+};
+
+// Reads TSP and ATSP files with EUC_2D, GEO, ATT or EXPLICIT edge weights.
+// EXPLICIT weights may be given as FULL_MATRIX or as any of the row and
+// column triangular formats
+class TsplibReader {
+ public:
+  // Methods
+  TsplibInstance Read(const std::string& path);
+  TsplibInstance Read(std::istream& input);
+
+ private:
+  std::map<std::string, std::string> specification_;
+  int dimension_ = 0;
+
+ private:
+  void ReadSpecification(const std::string& line);
+  void ReadCoordinates(std::istream& input, TsplibInstance* instance);
+  void ReadWeights(std::istream& input, TsplibInstance* instance);
+  std::string GetValue(const std::string& key) const;
+  static std::string Trim(const std::string& str);
+};
+
+}  // namespace ant
+
+}  // namespace s21
+
+#endif  // ANT_ALGORITHM_TSPLIB_READER_H_
@@ -40,6 +40,59 @@ class DisconnectedGraph : public std::exception {
   const char *what() const throw() { return "> Disconnected graph"; }
 };
 
+class ZeroPivot : public std::exception {
+ public:
+  const char *what() const throw() {
+    return "> Zero pivot. The system cannot be solved without row swaps";
+  }
+};
+
+class BatchTooLarge : public std::exception {
+ public:
+  const char *what() const throw() {
+    return "> The batch of systems is too large to be stored";
+  }
+};
+
+class InvalidAntParameters : public std::exception {
+ public:
+  const char *what() const throw() { return "> Invalid ant parameters"; }
+};
+
+class TsplibInputFailure : public std::exception {
+ public:
+  const char *what() const throw() { return "> TSPLIB input failure"; }
+};
+
+class InvalidHeldKarpSize : public std::exception {
+ public:
+  const char *what() const throw() {
+    return "> The exact solver takes from 2 to 25 vertices";
+  }
+};
+
+class InvalidEdgeChange : public std::exception {
+ public:
+  const char *what() const throw() { return "> Invalid edge change"; }
+};
+
+class ExportFailure : public std::exception {
+ public:
+  const char *what() const throw() { return "> Results export failure"; }
+};
+
+class TraceWriteFailure : public std::exception {
+ public:
+  const char *what() const throw() { return "> Trace write failure"; }
+};
+
+class NothingToReoptimize : public std::exception {
+ public:
+  const char *what() const throw() {
+    return "> Reoptimization needs a solved graph";
+  }
+};
+
 }  // namespace s21
 
 #endif  // EXCEPTIONS_EXCEPTIONS_H_
@@ -3,9 +3,19 @@
 using s21::ant::Facade;
 
 // Constructors
-Facade::Facade() { ant_algorithm_ = new AntAlgorithm(); }
+Facade::Facade() {
+  ant_algorithm_ = new AntAlgorithm();
+  island_model_ = new IslandModel();
+  candidate_ant_algorithm_ = new CandidateAntAlgorithm();
+  held_karp_ = new held_karp::HeldKarp();
+}
 
-Facade::~Facade() { delete ant_algorithm_; }
+Facade::~Facade() {
+  delete ant_algorithm_;
+  delete island_model_;
+  delete candidate_ant_algorithm_;
+  delete held_karp_;
+}
 
 // Methods
 s21::AlgorithmResults<typename Facade::result_type> Facade::GetSolution(
@@ -21,3 +31,62 @@ s21::AlgorithmResults<typename Facade::result_type> Facade::GetSolution(
   results.parallel_result = parallel_result;
   return results;
 }
+
+// Instances given by coordinates never build a dense matrix
+s21::AlgorithmResults<typename Facade::result_type> Facade::GetSolution(
+    const GeometricInstance& instance, const int iterations_quantity) {
+  AlgorithmResults<result_type> results;
+  results.sequential_result =
+      candidate_ant_algorithm_->SolveTravelingSalesmanProblemSequently(
+          instance, iterations_quantity);
+  results.parallel_result =
+      candidate_ant_algorithm_->SolveTravelingSalesmanProblemInParallel(
+          instance, iterations_quantity);
+  return results;
+}
+
+typename Facade::result_type Facade::GetIslandSolution(
+    const s21::Matrix& matrix, const int iterations_quantity) {
+  return island_model_->Solve(matrix, iterations_quantity);
+}
+
+// Optimal tours of graphs with up to held_karp::kMaxVerticesQuantity
+// vertices, to measure the ant algorithms against
+s21::AlgorithmResults<typename Facade::result_type> Facade::GetExactSolution(
+    const s21::Matrix& matrix, const int iterations_quantity) {
+  AlgorithmResults<result_type> results;
+  results.sequential_result =
+      held_karp_->SolveTravelingSalesmanProblemSequently(matrix,
+                                                         iterations_quantity);
+  results.parallel_result = held_karp_->SolveTravelingSalesmanProblemInParallel(
+      matrix, iterations_quantity);
+  return results;
+}
+
+void Facade::SetCandidatesQuantity(const int candidates_quantity) {
+  ant_algorithm_->SetCandidatesQuantity(candidates_quantity);
+  island_model_->SetCandidatesQuantity(candidates_quantity);
+  candidate_ant_algorithm_->SetCandidatesQuantity(candidates_quantity);
+}
+
+void Facade::SetParameters(const AntParameters& parameters) {
+  ant_algorithm_->SetParameters(parameters);
+  island_model_->SetParameters(parameters);
+  candidate_ant_algorithm_->SetParameters(parameters);
+}
+
+void Facade::SetIslandParameters(const IslandParameters& island_parameters) {
+  island_model_->SetIslandParameters(island_parameters);
+}
+
+void Facade::SetImprovementCallback(const improvement_callback& callback) {
+  ant_algorithm_->SetImprovementCallback(callback);
+  island_model_->SetImprovementCallback(callback);
+  candidate_ant_algorithm_->SetImprovementCallback(callback);
+}
+
+void Facade::SetCancellationToken(const CancellationToken* cancellation_token) {
+  ant_algorithm_->SetCancellationToken(cancellation_token);
+  island_model_->SetCancellationToken(cancellation_token);
+  candidate_ant_algorithm_->SetCancellationToken(cancellation_token);
+}
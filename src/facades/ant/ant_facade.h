@@ -3,6 +3,9 @@
 
 #include "../../algorithm_result/algorithm_result.h"
 #include "../../ant_algorithm/ant_algorithm.h"
+#include "../../ant_algorithm/candidate_ant_algorithm.h"
+#include "../../ant_algorithm/island_model.h"
+#include "../../held_karp_algorithm/held_karp.h"
 
 namespace s21 {
 
@@ -22,9 +25,23 @@ class Facade {
 
   AlgorithmResults<result_type> GetSolution(const s21::Matrix& matrix,
                                             const int iterations_quantity);
+  AlgorithmResults<result_type> GetSolution(const GeometricInstance& instance,
+                                            const int iterations_quantity);
+  result_type GetIslandSolution(const s21::Matrix& matrix,
+                                const int iterations_quantity);
+  AlgorithmResults<result_type> GetExactSolution(
+      const s21::Matrix& matrix, const int iterations_quantity);
+  void SetCandidatesQuantity(const int candidates_quantity);
+  void SetParameters(const AntParameters& parameters);
+  void SetIslandParameters(const IslandParameters& island_parameters);
+  void SetImprovementCallback(const improvement_callback& callback);
+  void SetCancellationToken(const CancellationToken* cancellation_token);
 
  private:
   AntAlgorithm* ant_algorithm_;
+  IslandModel* island_model_;
+  CandidateAntAlgorithm* candidate_ant_algorithm_;
+  held_karp::HeldKarp* held_karp_;
 };
 
 }  // namespace ant
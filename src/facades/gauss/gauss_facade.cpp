@@ -2,7 +2,11 @@
 
 using s21::gauss::Facade;
 
-Facade::Facade() { matrix_ = nullptr; }
+Facade::Facade() {
+  matrix_ = nullptr;
+  banded_matrix_ = nullptr;
+  sparse_matrix_ = nullptr;
+}
 
 Facade::~Facade() { RemoveObject(); }
 
@@ -15,6 +19,20 @@ void Facade::SetupMatrix(const s21::Matrix& matrix) {
 s21::AlgorithmResults<typename Facade::result_type> Facade::GetSolution(
     const int iterations_quantity) {
   AlgorithmResults<result_type> results;
+  if (banded_matrix_ != nullptr) {
+    results.sequential_result =
+        banded_matrix_->SolveSequentially(iterations_quantity);
+    results.parallel_result =
+        banded_matrix_->SolveInParallel(iterations_quantity);
+    return results;
+  }
+  if (sparse_matrix_ != nullptr) {
+    results.sequential_result =
+        sparse_matrix_->SolveSequentially(iterations_quantity);
+    results.parallel_result =
+        sparse_matrix_->SolveInParallel(iterations_quantity);
+    return results;
+  }
   result_type sequential_result =
       matrix_->SolveSequentially(iterations_quantity);
   result_type parallel_result = matrix_->SolveInParallel(iterations_quantity);
@@ -23,9 +41,37 @@ s21::AlgorithmResults<typename Facade::result_type> Facade::GetSolution(
   return results;
 }
 
+typename Facade::refined_result_type Facade::GetMixedPrecisionSolution(
+    const int iterations_quantity) {
+  if (matrix_ != nullptr) {
+    return matrix_->SolveWithMixedPrecision(iterations_quantity);
+  }
+  // Banded and sparse systems keep no dense copy, the refinement builds one
+  // for this call only
+  int rows = banded_matrix_ != nullptr ? banded_matrix_->GetRows()
+                                       : sparse_matrix_->GetRows();
+  Matrix matrix(rows, rows + 1);
+  if (banded_matrix_ != nullptr) {
+    banded_matrix_->CopyTo(&matrix);
+  } else {
+    sparse_matrix_->CopyTo(&matrix);
+  }
+  matrix.CacheValues();
+  return matrix.SolveWithMixedPrecision(iterations_quantity);
+}
+
 // Private functions
+
+// A system is stored in one representation only: banded and sparse systems
+// by their own storage, the rest densely
 void Facade::CreateObject(const s21::Matrix& matrix) {
-  matrix_ = new Matrix(matrix);
+  if (BandedMatrix::IsBanded(matrix)) {
+    banded_matrix_ = new BandedMatrix(matrix);
+  } else if (SparseMatrix::IsSparse(matrix)) {
+    sparse_matrix_ = new SparseMatrix(matrix);
+  } else {
+    matrix_ = new Matrix(matrix);
+  }
 }
 
 void Facade::RemoveObject() {
@@ -33,4 +79,12 @@ void Facade::RemoveObject() {
     delete matrix_;
     matrix_ = nullptr;
   }
+  if (banded_matrix_ != nullptr) {
+    delete banded_matrix_;
+    banded_matrix_ = nullptr;
+  }
+  if (sparse_matrix_ != nullptr) {
+    delete sparse_matrix_;
+    sparse_matrix_ = nullptr;
+  }
 }
@@ -1,7 +1,9 @@
 #ifndef FACADES_GAUSS_GAUSS_FACADE_H_
 #define FACADES_GAUSS_GAUSS_FACADE_H_
 
+#include "../../gauss_algorithm/banded.h"
 #include "../../gauss_algorithm/gauss.h"
+#include "../../gauss_algorithm/sparse_matrix.h"
 
 namespace s21 {
 
@@ -10,6 +12,7 @@ namespace gauss {
 class Facade {
  public:
   using result_type = Matrix::result_type;
+  using refined_result_type = Matrix::refined_result_type;
 
  public:
   // Constructors
@@ -23,9 +26,12 @@ class Facade {
   // Methods
   void SetupMatrix(const s21::Matrix& matrix);
   AlgorithmResults<result_type> GetSolution(const int iterations_quantity);
+  refined_result_type GetMixedPrecisionSolution(const int iterations_quantity);
 
  private:
   Matrix* matrix_;
+  BandedMatrix* banded_matrix_;
+  SparseMatrix* sparse_matrix_;
 
  private:
   void CreateObject(const s21::Matrix& matrix);
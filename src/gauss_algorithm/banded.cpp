@@ -0,0 +1,467 @@
+#include "banded.h"
+
+using s21::gauss::BandedMatrix;
+
+// Constructors
+BandedMatrix::BandedMatrix(const size_type rows,
+                           const size_type lower_bandwidth,
+                           const size_type upper_bandwidth) {
+  if (rows <= 0 || lower_bandwidth < 0 || upper_bandwidth < 0 ||
+      lower_bandwidth >= rows || upper_bandwidth >= rows) {
+    throw s21::InvalidMatrixSizes();
+  }
+  rows_ = rows;
+  lower_bandwidth_ = lower_bandwidth;
+  upper_bandwidth_ = upper_bandwidth;
+  width_ = lower_bandwidth + upper_bandwidth + 1;
+  threads_quantity_ = std::max(1u, std::thread::hardware_concurrency());
+  bands_.assign(rows_ * width_, 0);
+  rhs_.assign(rows_, 0);
+  work_bands_.resize(bands_.size());
+  work_rhs_.resize(rhs_.size());
+  solution_.resize(rows_);
+}
+
+BandedMatrix::BandedMatrix(const s21::Matrix& matrix)
+    : BandedMatrix(matrix, DetectBandwidth(matrix)) {}
+
+BandedMatrix::BandedMatrix(const s21::Matrix& matrix,
+                           const bandwidth_type& bandwidth)
+    : BandedMatrix(matrix.GetRows(), bandwidth.first, bandwidth.second) {
+  if (matrix.GetColumns() - matrix.GetRows() != 1) {
+    throw s21::InvalidGaussMatrix();
+  }
+  for (size_type i = 0; i < rows_; ++i) {
+    size_type first = std::max(0, i - lower_bandwidth_);
+    size_type last = std::min(rows_ - 1, i + upper_bandwidth_);
+    for (size_type j = first; j <= last; ++j) {
+      bands_[Index(i, j)] = matrix(i, j);
+    }
+    rhs_[i] = matrix(i, rows_);
+  }
+}
+
+// Methods
+typename BandedMatrix::result_type BandedMatrix::SolveSequentially(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      IsTridiagonal() ? std::bind(&BandedMatrix::Thomas, this)
+                      : std::bind(&BandedMatrix::BandElimination, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+typename BandedMatrix::result_type BandedMatrix::SolveInParallel(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      IsTridiagonal()
+          ? std::bind(&BandedMatrix::ParallelCyclicReduction, this)
+          : std::bind(&BandedMatrix::PartitionedElimination, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+typename BandedMatrix::bandwidth_type BandedMatrix::DetectBandwidth(
+    const s21::Matrix& matrix) {
+  size_type lower_bandwidth = 0, upper_bandwidth = 0;
+  size_type size = std::min(matrix.GetRows(), matrix.GetColumns());
+  for (size_type i = 0; i < matrix.GetRows(); ++i) {
+    for (size_type j = 0; j < size; ++j) {
+      if (matrix(i, j) != 0) {
+        lower_bandwidth = std::max(lower_bandwidth, i - j);
+        upper_bandwidth = std::max(upper_bandwidth, j - i);
+      }
+    }
+  }
+  return std::make_pair(lower_bandwidth, upper_bandwidth);
+}
+
+bool BandedMatrix::IsBanded(const s21::Matrix& matrix) {
+  if (matrix.GetRows() < kMinimumBandedRows ||
+      matrix.GetColumns() - matrix.GetRows() != 1) {
+    return false;
+  }
+  bandwidth_type bandwidth = DetectBandwidth(matrix);
+  size_type width = bandwidth.first + bandwidth.second + 1;
+  return width * kBandedWidthRatio <= matrix.GetRows();
+}
+
+// Writes the band and the right-hand side into a zeroed n x (n + 1) matrix
+void BandedMatrix::CopyTo(s21::Matrix* matrix) const {
+  for (size_type i = 0; i < rows_; ++i) {
+    size_type first = std::max(0, i - lower_bandwidth_);
+    size_type last = std::min(rows_ - 1, i + upper_bandwidth_);
+    for (size_type j = first; j <= last; ++j) {
+      (*matrix)(i, j) = bands_[Index(i, j)];
+    }
+    (*matrix)(i, rows_) = rhs_[i];
+  }
+}
+
+// Setters
+void BandedMatrix::SetValue(const size_type i, const size_type j,
+                            const value_type value) {
+  if (j == rows_) {
+    rhs_[i] = value;
+  } else if (IsInsideBand(i, j)) {
+    bands_[Index(i, j)] = value;
+  } else if (value != 0) {
+    throw s21::InvalidMatrixInput();
+  }
+}
+
+void BandedMatrix::SetThreadsQuantity(const int threads_quantity) {
+  threads_quantity_ = std::max(1, threads_quantity);
+}
+
+// Getters
+typename BandedMatrix::value_type BandedMatrix::GetValue(
+    const size_type i, const size_type j) const {
+  if (j == rows_) {
+    return rhs_[i];
+  }
+  return IsInsideBand(i, j) ? bands_[Index(i, j)] : 0;
+}
+
+typename BandedMatrix::size_type BandedMatrix::GetRows() const { return rows_; }
+
+typename BandedMatrix::size_type BandedMatrix::GetLowerBandwidth() const {
+  return lower_bandwidth_;
+}
+
+typename BandedMatrix::size_type BandedMatrix::GetUpperBandwidth() const {
+  return upper_bandwidth_;
+}
+
+bool BandedMatrix::IsTridiagonal() const {
+  return lower_bandwidth_ == 1 && upper_bandwidth_ == 1;
+}
+
+// Private functions
+typename BandedMatrix::result_type BandedMatrix::Solve(
+    std::function<void()> solving_method, const int iterations_quantity) {
+  result_.Reset();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    solving_method();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+  }
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(solution_);
+  return result_;
+}
+
+void BandedMatrix::Thomas() {
+  S21_TRACE_SCOPE("thomas");
+  std::vector<value_type>& c = work_c_;
+  std::vector<value_type>& d = work_d_;
+  c.resize(rows_);
+  d.resize(rows_);
+  for (size_type i = 0; i < rows_; ++i) {
+    value_type a = i > 0 ? bands_[Index(i, i - 1)] : 0;
+    value_type denominator = bands_[Index(i, i)] - (i > 0 ? a * c[i - 1] : 0);
+    if (denominator == 0) {
+      throw s21::ZeroPivot();
+    }
+    c[i] = i < rows_ - 1 ? bands_[Index(i, i + 1)] / denominator : 0;
+    d[i] = (rhs_[i] - (i > 0 ? a * d[i - 1] : 0)) / denominator;
+  }
+  solution_[rows_ - 1] = d[rows_ - 1];
+  for (size_type i = rows_ - 2; i >= 0; --i) {
+    solution_[i] = d[i] - c[i] * solution_[i + 1];
+  }
+}
+
+void BandedMatrix::BandElimination() {
+  S21_TRACE_SCOPE("band elimination");
+  work_bands_ = bands_;
+  work_rhs_ = rhs_;
+  for (size_type k = 0; k < rows_; ++k) {
+    value_type pivot = work_bands_[Index(k, k)];
+    if (pivot == 0) {
+      throw s21::ZeroPivot();
+    }
+    size_type last_row = std::min(rows_ - 1, k + lower_bandwidth_);
+    size_type last_column = std::min(rows_ - 1, k + upper_bandwidth_);
+    for (size_type i = k + 1; i <= last_row; ++i) {
+      value_type multiplier = work_bands_[Index(i, k)] / pivot;
+      if (multiplier == 0) continue;
+      for (size_type j = k; j <= last_column; ++j) {
+        work_bands_[Index(i, j)] -= multiplier * work_bands_[Index(k, j)];
+      }
+      work_rhs_[i] -= multiplier * work_rhs_[k];
+    }
+  }
+  for (size_type i = rows_ - 1; i >= 0; --i) {
+    value_type sum = work_rhs_[i];
+    size_type last_column = std::min(rows_ - 1, i + upper_bandwidth_);
+    for (size_type j = i + 1; j <= last_column; ++j) {
+      sum -= work_bands_[Index(i, j)] * solution_[j];
+    }
+    solution_[i] = sum / work_bands_[Index(i, i)];
+  }
+}
+
+// Every step couples row i with rows i - stride and i + stride only, so all
+// rows of a step are independent and are split between threads
+void BandedMatrix::ParallelCyclicReduction() {
+  LoadTridiagonal();
+  size_type threads_quantity = std::min(threads_quantity_, rows_);
+  for (size_type stride = 1; stride < rows_; stride *= 2) {
+    S21_TRACE_SCOPE("reduction step");
+    RunThreads(threads_quantity, [this, stride, threads_quantity](size_type t) {
+      return ReduceRows(stride, (rows_ * t) / threads_quantity,
+                        (rows_ * (t + 1)) / threads_quantity);
+    });
+    work_a_.swap(next_a_);
+    work_b_.swap(next_b_);
+    work_c_.swap(next_c_);
+    work_d_.swap(next_d_);
+  }
+  for (size_type i = 0; i < rows_; ++i) {
+    if (work_b_[i] == 0) {
+      throw s21::ZeroPivot();
+    }
+    solution_[i] = work_d_[i] / work_b_[i];
+  }
+}
+
+bool BandedMatrix::ReduceRows(const size_type stride, const size_type first_row,
+                              const size_type last_row) {
+  for (size_type i = first_row; i < last_row; ++i) {
+    value_type alpha = 0, gamma = 0;
+    next_b_[i] = work_b_[i];
+    next_d_[i] = work_d_[i];
+    if (i - stride >= 0) {
+      if (work_b_[i - stride] == 0) {
+        return false;
+      }
+      alpha = -work_a_[i] / work_b_[i - stride];
+      next_b_[i] += alpha * work_c_[i - stride];
+      next_d_[i] += alpha * work_d_[i - stride];
+    }
+    if (i + stride < rows_) {
+      if (work_b_[i + stride] == 0) {
+        return false;
+      }
+      gamma = -work_c_[i] / work_b_[i + stride];
+      next_b_[i] += gamma * work_a_[i + stride];
+      next_d_[i] += gamma * work_d_[i + stride];
+    }
+    next_a_[i] = i - stride >= 0 ? alpha * work_a_[i - stride] : 0;
+    next_c_[i] = i + stride < rows_ ? gamma * work_c_[i + stride] : 0;
+  }
+  return true;
+}
+
+// SPIKE: the rows are split into one partition per thread, and each thread
+// eliminates its diagonal block on its own. The block is solved for the
+// right-hand side and for the columns that couple it to its neighbours, the
+// spikes. The first upper_bandwidth and the last lower_bandwidth unknowns of
+// every partition then form a small banded system, whose solution lets each
+// thread recover the rest of its partition
+void BandedMatrix::PartitionedElimination() {
+  size_type coupling = lower_bandwidth_ + upper_bandwidth_;
+  size_type partitions_quantity =
+      coupling == 0 ? 1 : std::min(threads_quantity_, rows_ / coupling);
+  if (partitions_quantity < 2) {
+    BandElimination();
+    return;
+  }
+  work_bands_ = bands_;
+  work_rhs_ = rhs_;
+  spikes_.assign(static_cast<size_t>(rows_) * coupling, 0);
+  RunThreads(partitions_quantity, [this, partitions_quantity](size_type t) {
+    return EliminatePartition((rows_ * t) / partitions_quantity,
+                              (rows_ * (t + 1)) / partitions_quantity);
+  });
+  BandedMatrix reduced = BuildReducedSystem(partitions_quantity);
+  reduced.BandElimination();
+  RunThreads(partitions_quantity,
+             [this, partitions_quantity, &reduced](size_type t) {
+               RetrievePartition(t, partitions_quantity, reduced.solution_);
+               return true;
+             });
+}
+
+// Eliminates the rows [first_row, last_row) without looking outside them.
+// Row i of spikes_ starts with the coupling to the first upper_bandwidth
+// columns of the next partition, followed by the coupling to the last
+// lower_bandwidth columns of the previous one
+bool BandedMatrix::EliminatePartition(const size_type first_row,
+                                      const size_type last_row) {
+  size_type coupling = lower_bandwidth_ + upper_bandwidth_;
+  for (size_type i = first_row; i < last_row; ++i) {
+    value_type* spike = &spikes_[static_cast<size_t>(i) * coupling];
+    for (size_type c = 0; c < upper_bandwidth_; ++c) {
+      size_type j = last_row + c;
+      spike[c] = j < rows_ && IsInsideBand(i, j) ? bands_[Index(i, j)] : 0;
+    }
+    for (size_type c = 0; c < lower_bandwidth_; ++c) {
+      size_type j = first_row - lower_bandwidth_ + c;
+      spike[upper_bandwidth_ + c] =
+          j >= 0 && IsInsideBand(i, j) ? bands_[Index(i, j)] : 0;
+    }
+  }
+  for (size_type k = first_row; k < last_row; ++k) {
+    value_type pivot = work_bands_[Index(k, k)];
+    if (pivot == 0) {
+      return false;
+    }
+    size_type last_band_row = std::min(last_row - 1, k + lower_bandwidth_);
+    size_type last_column = std::min(last_row - 1, k + upper_bandwidth_);
+    const value_type* pivot_spike = &spikes_[static_cast<size_t>(k) * coupling];
+    for (size_type i = k + 1; i <= last_band_row; ++i) {
+      value_type multiplier = work_bands_[Index(i, k)] / pivot;
+      if (multiplier == 0) continue;
+      for (size_type j = k; j <= last_column; ++j) {
+        work_bands_[Index(i, j)] -= multiplier * work_bands_[Index(k, j)];
+      }
+      work_rhs_[i] -= multiplier * work_rhs_[k];
+      value_type* spike = &spikes_[static_cast<size_t>(i) * coupling];
+      for (size_type c = 0; c < coupling; ++c) {
+        spike[c] -= multiplier * pivot_spike[c];
+      }
+    }
+  }
+  for (size_type i = last_row - 1; i >= first_row; --i) {
+    value_type* spike = &spikes_[static_cast<size_t>(i) * coupling];
+    size_type last_column = std::min(last_row - 1, i + upper_bandwidth_);
+    for (size_type j = i + 1; j <= last_column; ++j) {
+      value_type value = work_bands_[Index(i, j)];
+      const value_type* solved_spike =
+          &spikes_[static_cast<size_t>(j) * coupling];
+      work_rhs_[i] -= value * work_rhs_[j];
+      for (size_type c = 0; c < coupling; ++c) {
+        spike[c] -= value * solved_spike[c];
+      }
+    }
+    value_type diagonal = work_bands_[Index(i, i)];
+    work_rhs_[i] /= diagonal;
+    for (size_type c = 0; c < coupling; ++c) {
+      spike[c] /= diagonal;
+    }
+  }
+  return true;
+}
+
+// Unknown p * coupling + c is the c-th of the first upper_bandwidth unknowns
+// of partition p, p * coupling + upper_bandwidth + c the c-th of its last
+// lower_bandwidth ones
+BandedMatrix BandedMatrix::BuildReducedSystem(
+    const size_type partitions_quantity) const {
+  size_type coupling = lower_bandwidth_ + upper_bandwidth_;
+  BandedMatrix reduced(partitions_quantity * coupling,
+                       std::max(0, upper_bandwidth_ + 2 * lower_bandwidth_ - 1),
+                       std::max(0, 2 * upper_bandwidth_ + lower_bandwidth_ - 1));
+  for (size_type p = 0; p < partitions_quantity; ++p) {
+    size_type first_row = (rows_ * p) / partitions_quantity;
+    size_type last_row = (rows_ * (p + 1)) / partitions_quantity;
+    for (size_type c = 0; c < coupling; ++c) {
+      size_type i = c < upper_bandwidth_
+                        ? first_row + c
+                        : last_row - coupling + c;
+      size_type row = p * coupling + c;
+      const value_type* spike = &spikes_[static_cast<size_t>(i) * coupling];
+      reduced.SetValue(row, row, 1);
+      reduced.SetValue(row, reduced.rows_, work_rhs_[i]);
+      for (size_type s = 0; s < upper_bandwidth_; ++s) {
+        if (p + 1 < partitions_quantity) {
+          reduced.SetValue(row, (p + 1) * coupling + s, spike[s]);
+        }
+      }
+      for (size_type s = 0; s < lower_bandwidth_; ++s) {
+        if (p > 0) {
+          reduced.SetValue(row, (p - 1) * coupling + upper_bandwidth_ + s,
+                           spike[upper_bandwidth_ + s]);
+        }
+      }
+    }
+  }
+  return reduced;
+}
+
+void BandedMatrix::RetrievePartition(const size_type partition,
+                                     const size_type partitions_quantity,
+                                     const solution_type& reduced_solution) {
+  size_type coupling = lower_bandwidth_ + upper_bandwidth_;
+  size_type first_row = (rows_ * partition) / partitions_quantity;
+  size_type last_row = (rows_ * (partition + 1)) / partitions_quantity;
+  const value_type* next =
+      partition + 1 < partitions_quantity
+          ? &reduced_solution[(partition + 1) * coupling]
+          : nullptr;
+  const value_type* previous =
+      partition > 0 ? &reduced_solution[(partition - 1) * coupling +
+                                        upper_bandwidth_]
+                    : nullptr;
+  for (size_type i = first_row; i < last_row; ++i) {
+    const value_type* spike = &spikes_[static_cast<size_t>(i) * coupling];
+    value_type value = work_rhs_[i];
+    for (size_type c = 0; next != nullptr && c < upper_bandwidth_; ++c) {
+      value -= spike[c] * next[c];
+    }
+    for (size_type c = 0; previous != nullptr && c < lower_bandwidth_; ++c) {
+      value -= spike[upper_bandwidth_ + c] * previous[c];
+    }
+    solution_[i] = value;
+  }
+}
+
+// Runs task(t) for every t in [0, threads_quantity) on a thread of its own. A
+// task returns false on a zero pivot, which is thrown once all have joined
+void BandedMatrix::RunThreads(const size_type threads_quantity,
+                              std::function<bool(size_type)> task) {
+  std::vector<std::thread> threads;
+  std::vector<char> are_solved(threads_quantity, true);
+  ReserveThreadCounters(&thread_counters_, threads_quantity);
+  for (size_type t = 0; t < threads_quantity; ++t) {
+    threads.push_back(std::thread([this, &task, &are_solved, t]() {
+      ScopedThreadCounters counters(&thread_counters_[t]);
+      S21_TRACE_SCOPE("row band");
+      are_solved[t] = task(t);
+    }));
+  }
+  {
+    S21_TRACE_SCOPE("join");
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+  if (std::find(are_solved.begin(), are_solved.end(), false) !=
+      are_solved.end()) {
+    throw s21::ZeroPivot();
+  }
+}
+
+void BandedMatrix::LoadTridiagonal() {
+  for (std::vector<value_type>* diagonal :
+       {&work_a_, &work_b_, &work_c_, &work_d_, &next_a_, &next_b_, &next_c_,
+        &next_d_}) {
+    diagonal->resize(rows_);
+  }
+  for (size_type i = 0; i < rows_; ++i) {
+    work_a_[i] = i > 0 ? bands_[Index(i, i - 1)] : 0;
+    work_b_[i] = bands_[Index(i, i)];
+    work_c_[i] = i < rows_ - 1 ? bands_[Index(i, i + 1)] : 0;
+    work_d_[i] = rhs_[i];
+  }
+}
+
+typename BandedMatrix::size_type BandedMatrix::Index(const size_type i,
+                                                     const size_type j) const {
+  return i * width_ + (j - i + lower_bandwidth_);
+}
+
+bool BandedMatrix::IsInsideBand(const size_type i, const size_type j) const {
+  return j - i <= upper_bandwidth_ && i - j <= lower_bandwidth_;
+}
@@ -0,0 +1,98 @@
+#ifndef GAUSS_BANDED_H_
+#define GAUSS_BANDED_H_
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+#include "../timer/timer.h"
+#include "../tracing/tracing.h"
+
+namespace s21 {
+
+namespace gauss {
+
+// A system is stored as banded when its band is at most a quarter of the rows
+constexpr int kBandedWidthRatio = 4;
+constexpr int kMinimumBandedRows = 8;
+
+// Stores only the diagonals of an augmented n x (n + 1) system that lie
+// inside [-lower_bandwidth, upper_bandwidth], so memory is O(n * band)
+class BandedMatrix {
+ public:
+  using value_type = double;
+  using size_type = int;
+  using bandwidth_type = std::pair<size_type, size_type>;
+  using solution_type = std::vector<value_type>;
+  using result_type = AlgorithmResult<solution_type>;
+
+ public:
+  // Constructors
+  BandedMatrix(const size_type rows, const size_type lower_bandwidth,
+               const size_type upper_bandwidth);
+  BandedMatrix(const s21::Matrix& matrix);
+
+  // Methods
+  result_type SolveSequentially(const int iterations_quantity);
+  result_type SolveInParallel(const int iterations_quantity);
+  static bandwidth_type DetectBandwidth(const s21::Matrix& matrix);
+  static bool IsBanded(const s21::Matrix& matrix);
+  void CopyTo(s21::Matrix* matrix) const;
+
+  // Setters
+  void SetValue(const size_type i, const size_type j, const value_type value);
+  void SetThreadsQuantity(const int threads_quantity);
+
+  // Getters
+  value_type GetValue(const size_type i, const size_type j) const;
+  size_type GetRows() const;
+  size_type GetLowerBandwidth() const;
+  size_type GetUpperBandwidth() const;
+  bool IsTridiagonal() const;
+
+ private:
+  size_type rows_, lower_bandwidth_, upper_bandwidth_, width_;
+  int threads_quantity_;
+  std::vector<value_type> bands_;  // row i holds columns [i - lower, i + upper]
+  std::vector<value_type> rhs_;
+  std::vector<value_type> work_bands_;
+  std::vector<value_type> work_rhs_;
+  std::vector<value_type> work_a_, work_b_, work_c_, work_d_;
+  std::vector<value_type> next_a_, next_b_, next_c_, next_d_;
+  std::vector<value_type> spikes_;  // row i couples it to the neighbours
+  solution_type solution_;
+  result_type result_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
+
+ private:
+  BandedMatrix(const s21::Matrix& matrix, const bandwidth_type& bandwidth);
+  result_type Solve(std::function<void()> solving_method,
+                    const int iterations_quantity);
+  void Thomas();
+  void BandElimination();
+  void ParallelCyclicReduction();
+  bool ReduceRows(const size_type stride, const size_type first_row,
+                  const size_type last_row);
+  void PartitionedElimination();
+  bool EliminatePartition(const size_type first_row, const size_type last_row);
+  BandedMatrix BuildReducedSystem(const size_type partitions_quantity) const;
+  void RetrievePartition(const size_type partition,
+                         const size_type partitions_quantity,
+                         const solution_type& reduced_solution);
+  void RunThreads(const size_type threads_quantity,
+                  std::function<bool(size_type)> task);
+  void LoadTridiagonal();
+  size_type Index(const size_type i, const size_type j) const;
+  bool IsInsideBand(const size_type i, const size_type j) const;
+};
+
+}  // namespace gauss
+
+}  // namespace s21
+
+#endif  // GAUSS_BANDED_H_
@@ -0,0 +1,230 @@
+#include "batched.h"
+
+using s21::gauss::BatchedSystems;
+
+// Constructors
+
+// A block is indexed in size_type, the whole buffer in index_type. Sizes
+// whose block or buffer does not fit are rejected before anything is
+// allocated
+BatchedSystems::BatchedSystems(const size_type systems_quantity,
+                               const size_type rows) {
+  if (systems_quantity <= 0 || rows <= 0) {
+    throw s21::InvalidMatrixSizes();
+  }
+  if (index_type{rows} * (index_type{rows} + 1) >
+      std::numeric_limits<size_type>::max() / kBatchLanes) {
+    throw s21::BatchTooLarge();
+  }
+  systems_quantity_ = systems_quantity;
+  rows_ = rows;
+  columns_ = rows + 1;
+  blocks_quantity_ = (systems_quantity_ - 1) / kBatchLanes + 1;
+  block_size_ = rows_ * columns_ * kBatchLanes;
+  if (index_type{blocks_quantity_} * block_size_ >
+      static_cast<index_type>(values_.max_size())) {
+    throw s21::BatchTooLarge();
+  }
+  threads_quantity_ = std::max(1u, std::thread::hardware_concurrency());
+  values_.assign(index_type{blocks_quantity_} * block_size_, 0);
+  solutions_.assign(index_type{blocks_quantity_} * rows_ * kBatchLanes, 0);
+  // Padding lanes of the last block hold identity systems
+  index_type last_block = index_type{blocks_quantity_ - 1} * block_size_;
+  for (int lane = systems_quantity_ - (blocks_quantity_ - 1) * kBatchLanes;
+       lane < kBatchLanes; ++lane) {
+    for (size_type i = 0; i < rows_; ++i) {
+      values_[last_block + (i * columns_ + i) * kBatchLanes + lane] = 1;
+    }
+  }
+}
+
+// Methods
+typename BatchedSystems::result_type BatchedSystems::SolveSequentially(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&BatchedSystems::EliminateAll, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+typename BatchedSystems::result_type BatchedSystems::SolveInParallel(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&BatchedSystems::ParallelEliminate, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+// Setters
+void BatchedSystems::SetValue(const size_type system, const size_type i,
+                              const size_type j, const value_type value) {
+  values_[Index(system, i, j)] = value;
+}
+
+void BatchedSystems::SetThreadsQuantity(const int threads_quantity) {
+  threads_quantity_ = std::max(1, threads_quantity);
+}
+
+// Getters
+typename BatchedSystems::value_type BatchedSystems::GetValue(
+    const size_type system, const size_type i, const size_type j) const {
+  return values_[Index(system, i, j)];
+}
+
+typename BatchedSystems::solution_type BatchedSystems::GetSolution(
+    const size_type system) const {
+  solution_type solution(rows_);
+  const value_type* block =
+      &solutions_[index_type{system / kBatchLanes} * rows_ * kBatchLanes];
+  for (size_type i = 0; i < rows_; ++i) {
+    solution[i] = block[i * kBatchLanes + system % kBatchLanes];
+  }
+  return solution;
+}
+
+typename BatchedSystems::size_type BatchedSystems::GetSystemsQuantity() const {
+  return systems_quantity_;
+}
+
+typename BatchedSystems::size_type BatchedSystems::GetRows() const {
+  return rows_;
+}
+
+// Private functions
+typename BatchedSystems::result_type BatchedSystems::Solve(
+    std::function<void()> solving_method, const int iterations_quantity) {
+  result_.Reset();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    solving_method();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+  }
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(CollectSolutions());
+  return result_;
+}
+
+void BatchedSystems::EliminateAll() {
+  S21_TRACE_SCOPE("blocks");
+  work_.resize(1);
+  EliminateBlocks(0, blocks_quantity_, 0);
+}
+
+void BatchedSystems::ParallelEliminate() {
+  int threads_quantity = std::min(threads_quantity_, blocks_quantity_);
+  work_.resize(threads_quantity);
+  std::vector<std::thread> threads;
+  ReserveThreadCounters(&thread_counters_, threads_quantity);
+  for (int i = 1; i <= threads_quantity; ++i) {
+    threads.push_back(std::thread([this, threads_quantity, i]() {
+      ScopedThreadCounters counters(&thread_counters_[i - 1]);
+      S21_TRACE_SCOPE("blocks");
+      EliminateBlocks((blocks_quantity_ * (i - 1)) / threads_quantity,
+                      (blocks_quantity_ * i) / threads_quantity, i - 1);
+    }));
+  }
+  S21_TRACE_SCOPE("join");
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+void BatchedSystems::EliminateBlocks(const size_type first_block,
+                                     const size_type last_block,
+                                     const int worker) {
+  std::vector<value_type>& work = work_[worker];
+  work.resize(block_size_);
+  for (size_type block = first_block; block < last_block; ++block) {
+    EliminateBlock(block, work.data());
+  }
+}
+
+// Gaussian elimination with partial pivoting chosen independently per lane
+void BatchedSystems::EliminateBlock(const size_type block, value_type* work) {
+  const size_type n = rows_, stride = columns_ * kBatchLanes;
+  std::copy(values_.begin() + index_type{block} * block_size_,
+            values_.begin() + (index_type{block} + 1) * block_size_, work);
+  value_type multiplier[kBatchLanes], inverse[kBatchLanes],
+      largest[kBatchLanes];
+  size_type pivot_row[kBatchLanes];
+  for (size_type k = 0; k < n; ++k) {
+    value_type* pivot = work + k * stride;
+    for (int lane = 0; lane < kBatchLanes; ++lane) {
+      largest[lane] = std::fabs(pivot[k * kBatchLanes + lane]);
+      pivot_row[lane] = k;
+    }
+    for (size_type i = k + 1; i < n; ++i) {
+      const value_type* row = work + i * stride + k * kBatchLanes;
+      for (int lane = 0; lane < kBatchLanes; ++lane) {
+        bool is_larger = std::fabs(row[lane]) > largest[lane];
+        largest[lane] = is_larger ? std::fabs(row[lane]) : largest[lane];
+        pivot_row[lane] = is_larger ? i : pivot_row[lane];
+      }
+    }
+    for (int lane = 0; lane < kBatchLanes; ++lane) {
+      if (pivot_row[lane] == k) continue;
+      value_type* other = work + pivot_row[lane] * stride;
+      for (size_type j = k; j < columns_; ++j) {
+        std::swap(pivot[j * kBatchLanes + lane], other[j * kBatchLanes + lane]);
+      }
+    }
+    for (int lane = 0; lane < kBatchLanes; ++lane) {
+      inverse[lane] = 1 / pivot[k * kBatchLanes + lane];
+    }
+    for (size_type i = k + 1; i < n; ++i) {
+      value_type* row = work + i * stride;
+      for (int lane = 0; lane < kBatchLanes; ++lane) {
+        multiplier[lane] = row[k * kBatchLanes + lane] * inverse[lane];
+      }
+      for (size_type j = k; j < columns_; ++j) {
+        for (int lane = 0; lane < kBatchLanes; ++lane) {
+          row[j * kBatchLanes + lane] -=
+              multiplier[lane] * pivot[j * kBatchLanes + lane];
+        }
+      }
+    }
+  }
+  value_type* solution = &solutions_[index_type{block} * n * kBatchLanes];
+  for (size_type i = n - 1; i >= 0; --i) {
+    const value_type* row = work + i * stride;
+    value_type* x = solution + i * kBatchLanes;
+    for (int lane = 0; lane < kBatchLanes; ++lane) {
+      x[lane] = row[n * kBatchLanes + lane];
+    }
+    for (size_type j = i + 1; j < n; ++j) {
+      const value_type* known = solution + j * kBatchLanes;
+      for (int lane = 0; lane < kBatchLanes; ++lane) {
+        x[lane] -= row[j * kBatchLanes + lane] * known[lane];
+      }
+    }
+    for (int lane = 0; lane < kBatchLanes; ++lane) {
+      x[lane] /= row[i * kBatchLanes + lane];
+    }
+  }
+}
+
+typename BatchedSystems::solution_type BatchedSystems::CollectSolutions()
+    const {
+  solution_type solutions;
+  solutions.reserve(index_type{systems_quantity_} * rows_);
+  for (size_type system = 0; system < systems_quantity_; ++system) {
+    solution_type solution = GetSolution(system);
+    solutions.insert(solutions.end(), solution.begin(), solution.end());
+  }
+  return solutions;
+}
+
+typename BatchedSystems::index_type BatchedSystems::Index(
+    const size_type system, const size_type i, const size_type j) const {
+  return index_type{system / kBatchLanes} * block_size_ +
+         (i * columns_ + j) * kBatchLanes + system % kBatchLanes;
+}
@@ -0,0 +1,83 @@
+#ifndef GAUSS_BATCHED_H_
+#define GAUSS_BATCHED_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../exceptions/exceptions.h"
+#include "../timer/timer.h"
+#include "../tracing/tracing.h"
+
+namespace s21 {
+
+namespace gauss {
+
+// Systems eliminated together, one per SIMD lane
+constexpr int kBatchLanes = 8;
+
+// Many independent augmented rows x (rows + 1) systems of the same size.
+// Systems are grouped in blocks of kBatchLanes and a block is interleaved,
+// so element (i, j) of all systems in a block is contiguous and every
+// elimination step is a loop over lanes that the compiler vectorizes.
+// Singular systems produce non-finite solutions instead of an exception.
+class BatchedSystems {
+ public:
+  using value_type = double;
+  using size_type = int;
+  using index_type = int64_t;  // of the flat buffers, which exceed int
+  using solution_type = std::vector<value_type>;
+  using result_type = AlgorithmResult<solution_type>;
+
+ public:
+  // Constructors
+  BatchedSystems(const size_type systems_quantity, const size_type rows);
+
+  // Methods
+  result_type SolveSequentially(const int iterations_quantity);
+  result_type SolveInParallel(const int iterations_quantity);
+
+  // Setters
+  void SetValue(const size_type system, const size_type i, const size_type j,
+                const value_type value);
+  void SetThreadsQuantity(const int threads_quantity);
+
+  // Getters
+  value_type GetValue(const size_type system, const size_type i,
+                      const size_type j) const;
+  solution_type GetSolution(const size_type system) const;
+  size_type GetSystemsQuantity() const;
+  size_type GetRows() const;
+
+ private:
+  size_type systems_quantity_, rows_, columns_, blocks_quantity_, block_size_;
+  int threads_quantity_;
+  std::vector<value_type> values_;
+  std::vector<value_type> solutions_;
+  std::vector<std::vector<value_type>> work_;
+  result_type result_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
+
+ private:
+  result_type Solve(std::function<void()> solving_method,
+                    const int iterations_quantity);
+  void EliminateAll();
+  void ParallelEliminate();
+  void EliminateBlocks(const size_type first_block, const size_type last_block,
+                       const int worker);
+  void EliminateBlock(const size_type block, value_type* work);
+  solution_type CollectSolutions() const;
+  index_type Index(const size_type system, const size_type i,
+                   const size_type j) const;
+};
+
+}  // namespace gauss
+
+}  // namespace s21
+
+#endif  // GAUSS_BATCHED_H_
@@ -15,7 +15,10 @@ Matrix::Matrix(const size_type rows, const size_type columns) {
   AllocateValues();
 }
 
-Matrix::Matrix(const s21::Matrix& matrix) { Copy(matrix); }
+Matrix::Matrix(const s21::Matrix& matrix) {
+  Copy(matrix);
+  CacheValues();
+}
 
 // Functions
 typename Matrix::result_type Matrix::SolveSequentially(
@@ -34,6 +37,32 @@ typename Matrix::result_type Matrix::SolveInParallel(
   return Solve(forward_method, backward_method, iterations_quantity);
 }
 
+typename Matrix::refined_result_type Matrix::SolveWithMixedPrecision(
+    const int iterations_quantity) {
+  if (!IsCorrect()) {
+    throw s21::InvalidGaussMatrix();
+  }
+  refined_result_.Reset();
+  GetValuesFromCache();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    MixedPrecisionSolve();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    refined_result_.AddTimestamp(timestamp);
+    refined_result_.AddCounters(iteration_counters.Sample());
+  }
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  refined_result_.SetTotalExecutionTime(timestamp);
+  refined_result_.SetSolution(refined_solution_);
+  return refined_result_;
+}
+
 typename Matrix::result_type Matrix::Solve(
     std::function<void()> forward_method, std::function<void()> backward_method,
     const int iterations_quantity) {
@@ -41,16 +70,24 @@ typename Matrix::result_type Matrix::Solve(
     throw s21::InvalidGaussMatrix();
   }
   result_.Reset();
-  GetValuesFromCache();
   Timer total_time_timer;
   Timer average_time_timer;
+  PerfCounters iteration_counters(true);
   total_time_timer.Begin();
   for (int i = 0; i < iterations_quantity; ++i) {
+    // Every iteration starts from the original system, the restore is not
+    // part of the measured time
+    GetValuesFromCache();
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
     average_time_timer.Begin();
     forward_method();
     backward_method();
     s21::TimeRange timestamp = average_time_timer.Timestamp();
     result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
   }
   s21::TimeRange timestamp = total_time_timer.Timestamp();
   result_.SetTotalExecutionTime(timestamp);
@@ -69,7 +106,75 @@ typename Matrix::solution_type Matrix::GetSolution() {
 }
 
 // Private functions
+
+// Factors in float and recovers double accuracy by solving for corrections of
+// the double residual with the float factors (mixed precision refinement)
+void Matrix::MixedPrecisionSolve() {
+  S21_TRACE_SCOPE("mixed precision solve");
+  std::vector<double>& solution = refined_solution_.values;
+  refined_solution_.refinement_iterations = 0;
+  refined_solution_.is_fallback = false;
+  rhs_.resize(rows_);
+  for (size_type i = 0; i < rows_; ++i) {
+    rhs_[i] = values_[i][columns_ - 1];
+  }
+  if (!float_decomposition_.Factor(*this)) {
+    DoublePrecisionSolve();
+    return;
+  }
+  float_decomposition_.Solve(rhs_, &solution);
+  double tolerance = std::numeric_limits<double>::epsilon() * std::sqrt(rows_);
+  for (int i = 0; i < kMaxRefinementIterations; ++i) {
+    refined_solution_.residual = CalculateResidual(solution);
+    if (refined_solution_.residual <= tolerance) {
+      return;
+    }
+    float_decomposition_.Solve(residual_, &correction_);
+    for (size_type j = 0; j < rows_; ++j) {
+      solution[j] += correction_[j];
+    }
+    ++refined_solution_.refinement_iterations;
+  }
+  refined_solution_.residual = CalculateResidual(solution);
+  if (!(refined_solution_.residual <= tolerance)) {
+    DoublePrecisionSolve();
+  }
+}
+
+void Matrix::DoublePrecisionSolve() {
+  S21_TRACE_SCOPE("double precision fallback");
+  refined_solution_.is_fallback = true;
+  if (!double_decomposition_.Factor(*this)) {
+    throw s21::ZeroPivot();
+  }
+  double_decomposition_.Solve(rhs_, &refined_solution_.values);
+  refined_solution_.residual = CalculateResidual(refined_solution_.values);
+}
+
+// Fills residual_ with b - Ax and returns its normwise backward error
+// ||b - Ax|| / (||A|| * ||x|| + ||b||) in the infinity norm
+double Matrix::CalculateResidual(const std::vector<double>& solution) {
+  S21_TRACE_SCOPE("residual");
+  residual_.resize(rows_);
+  double residual_norm = 0, matrix_norm = 0, solution_norm = 0, rhs_norm = 0;
+  for (size_type i = 0; i < rows_; ++i) {
+    double sum = rhs_[i], row_norm = 0;
+    for (size_type j = 0; j < rows_; ++j) {
+      sum -= values_[i][j] * solution[j];
+      row_norm += std::fabs(values_[i][j]);
+    }
+    residual_[i] = sum;
+    residual_norm = std::max(residual_norm, std::fabs(sum));
+    matrix_norm = std::max(matrix_norm, row_norm);
+    solution_norm = std::max(solution_norm, std::fabs(solution[i]));
+    rhs_norm = std::max(rhs_norm, std::fabs(rhs_[i]));
+  }
+  double scale = matrix_norm * solution_norm + rhs_norm;
+  return scale == 0 ? residual_norm : residual_norm / scale;
+}
+
 void Matrix::Forward() {
+  S21_TRACE_SCOPE("forward elimination");
   for (size_type current_row = 0; current_row < rows_ - 1; ++current_row) {
     DivideRow(current_row);
     for (size_type next_row = current_row + 1; next_row < rows_; ++next_row) {
@@ -81,6 +186,7 @@ void Matrix::Forward() {
 }
 
 void Matrix::Backward() {
+  S21_TRACE_SCOPE("back substitution");
   for (size_type current_row = rows_ - 1; current_row > 0; --current_row) {
     DivideRow(current_row);
     for (size_type prev_row = current_row - 1; prev_row >= 0; --prev_row) {
@@ -92,47 +198,65 @@ void Matrix::Backward() {
 }
 
 void Matrix::ParallelForward() {
+  S21_TRACE_SCOPE("forward elimination");
+  ReserveThreadCounters(&thread_counters_, kParallelThreadsQuantity);
   for (size_type current_row = 0; current_row < rows_; ++current_row) {
     DivideRow(current_row);
     mutex_.unlock();
     size_type middle_row = (rows_ - current_row) / 2;
     std::thread t1([this, current_row, middle_row]() {
+      ScopedThreadCounters counters(&thread_counters_[0]);
+      S21_TRACE_SCOPE("row band");
       for (size_type next_row = current_row + 1;
            next_row < current_row + middle_row; ++next_row) {
         ProcessRows(current_row, next_row);
       }
     });
     std::thread t2([this, current_row, middle_row]() {
+      ScopedThreadCounters counters(&thread_counters_[1]);
+      S21_TRACE_SCOPE("row band");
       for (size_type next_row = current_row + middle_row; next_row < rows_;
            ++next_row) {
         ProcessRows(current_row, next_row);
       }
     });
-    t1.join();
-    t2.join();
+    {
+      S21_TRACE_SCOPE("join");
+      t1.join();
+      t2.join();
+    }
     mutex_.lock();
   }
 }
 
 void Matrix::ParallelBackward() {
+  S21_TRACE_SCOPE("back substitution");
+  ReserveThreadCounters(&thread_counters_, kParallelThreadsQuantity);
   for (size_type current_row = rows_ - 1; current_row >= 0; --current_row) {
     DivideRow(current_row);
     mutex_.unlock();
     size_type middle_row = rows_ - (rows_ / 2) - ((rows_ - current_row) / 2);
     std::thread t1([this, current_row, middle_row]() {
+      ScopedThreadCounters counters(&thread_counters_[0]);
+      S21_TRACE_SCOPE("row band");
       for (size_type prev_row = current_row - 1;
            prev_row > current_row - middle_row; --prev_row) {
         ProcessRows(current_row, prev_row);
       }
     });
     std::thread t2([this, current_row, middle_row]() {
+      ScopedThreadCounters counters(&thread_counters_[1]);
+      S21_TRACE_SCOPE("row band");
       for (size_type prev_row = current_row - middle_row; prev_row > -1;
            --prev_row) {
         ProcessRows(current_row, prev_row);
       }
     });
-    t1.join();
-    t2.join();
+    {
+      S21_TRACE_SCOPE("join");
+      t1.join();
+      t2.join();
+    }
     mutex_.lock();
   }
   double divisor = values_[0][0];
@@ -149,6 +273,7 @@ void Matrix::ProcessRows(const size_type first_row_index,
 }
 
 void Matrix::DivideRow(const size_type row_index) {
+  S21_TRACE_SCOPE("pivot");
   double divisor = values_[row_index][row_index];
   if (divisor != 0) {
     DivideEachElementOfRow(row_index, divisor);
@@ -4,6 +4,7 @@
 #include <array>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <mutex>
 #include <random>
 #include <thread>
@@ -13,15 +14,28 @@
 #include "../exceptions/exceptions.h"
 #include "../matrix.h"
 #include "../timer/timer.h"
+#include "../tracing/tracing.h"
+#include "lu_decomposition.h"
 
 namespace s21 {
 
 namespace gauss {
 
+constexpr int kMaxRefinementIterations = 30;
+constexpr int kParallelThreadsQuantity = 2;  // of the parallel elimination
+
+struct RefinedSolution {
+  std::vector<double> values;
+  int refinement_iterations{0};
+  double residual{INFINITY};
+  bool is_fallback{false};
+};
+
 class Matrix : public s21::Matrix {
  public:
   using solution_type = std::vector<s21::Matrix::value_type>;
   using result_type = AlgorithmResult<solution_type>;
+  using refined_result_type = AlgorithmResult<RefinedSolution>;
   using size_type = int;
 
  public:
@@ -33,10 +47,17 @@ class Matrix : public s21::Matrix {
   // Methods
   result_type SolveSequentially(const int iterations_quantity);
   result_type SolveInParallel(const int iterations_quantity);
+  refined_result_type SolveWithMixedPrecision(const int iterations_quantity);
 
  private:
   std::mutex mutex_;
   result_type result_;
+  refined_result_type refined_result_;
+  LuDecomposition<float> float_decomposition_;
+  LuDecomposition<double> double_decomposition_;
+  RefinedSolution refined_solution_;
+  std::vector<double> rhs_, residual_, correction_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
 
  private:
   result_type Solve(std::function<void()> forward_method,
@@ -46,6 +67,9 @@ class Matrix : public s21::Matrix {
   void Backward();
   void ParallelForward();
   void ParallelBackward();
+  void MixedPrecisionSolve();
+  void DoublePrecisionSolve();
+  double CalculateResidual(const std::vector<double>& solution);
 
   void ProcessRows(const size_type first_row_index,
                    const size_type second_row_index);
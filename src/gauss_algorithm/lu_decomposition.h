@@ -0,0 +1,113 @@
+#ifndef GAUSS_LU_DECOMPOSITION_H_
+#define GAUSS_LU_DECOMPOSITION_H_
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "../matrix.h"
+
+namespace s21 {
+
+namespace gauss {
+
+// LU factorization with partial pivoting of the square part of an augmented
+// system, kept in a contiguous row-major buffer of type T
+template <class T>
+class LuDecomposition {
+ public:
+  using value_type = T;
+  using size_type = int;
+
+ public:
+  // Methods
+  bool Factor(const s21::Matrix& matrix);
+  void Solve(const std::vector<double>& rhs, std::vector<double>* solution);
+
+  // Getters
+  size_type GetSize() const;
+
+ private:
+  size_type size_ = 0;
+  std::vector<value_type> values_;
+  std::vector<size_type> permutation_;
+  std::vector<value_type> work_;
+};
+
+// Methods
+template <typename T>
+bool LuDecomposition<T>::Factor(const s21::Matrix& matrix) {
+  size_ = matrix.GetRows();
+  values_.resize(size_ * size_);
+  permutation_.resize(size_);
+  work_.resize(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    permutation_[i] = i;
+    for (size_type j = 0; j < size_; ++j) {
+      values_[i * size_ + j] = static_cast<value_type>(matrix(i, j));
+    }
+  }
+  for (size_type k = 0; k < size_; ++k) {
+    size_type pivot_row = k;
+    for (size_type i = k + 1; i < size_; ++i) {
+      if (std::fabs(values_[i * size_ + k]) >
+          std::fabs(values_[pivot_row * size_ + k])) {
+        pivot_row = i;
+      }
+    }
+    if (values_[pivot_row * size_ + k] == 0) {
+      return false;
+    }
+    if (pivot_row != k) {
+      for (size_type j = 0; j < size_; ++j) {
+        std::swap(values_[k * size_ + j], values_[pivot_row * size_ + j]);
+      }
+      std::swap(permutation_[k], permutation_[pivot_row]);
+    }
+    value_type* pivot = &values_[k * size_];
+    for (size_type i = k + 1; i < size_; ++i) {
+      value_type* row = &values_[i * size_];
+      value_type multiplier = row[k] / pivot[k];
+      row[k] = multiplier;
+      for (size_type j = k + 1; j < size_; ++j) {
+        row[j] -= multiplier * pivot[j];
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void LuDecomposition<T>::Solve(const std::vector<double>& rhs,
+                               std::vector<double>* solution) {
+  for (size_type i = 0; i < size_; ++i) {
+    value_type sum = static_cast<value_type>(rhs[permutation_[i]]);
+    for (size_type j = 0; j < i; ++j) {
+      sum -= values_[i * size_ + j] * work_[j];
+    }
+    work_[i] = sum;
+  }
+  for (size_type i = size_ - 1; i >= 0; --i) {
+    value_type sum = work_[i];
+    for (size_type j = i + 1; j < size_; ++j) {
+      sum -= values_[i * size_ + j] * work_[j];
+    }
+    work_[i] = sum / values_[i * size_ + i];
+  }
+  solution->resize(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    (*solution)[i] = static_cast<double>(work_[i]);
+  }
+}
+
+// Getters
+template <typename T>
+typename LuDecomposition<T>::size_type LuDecomposition<T>::GetSize() const {
+  return size_;
+}
+
+}  // namespace gauss
+
+}  // namespace s21
+
+#endif  // GAUSS_LU_DECOMPOSITION_H_
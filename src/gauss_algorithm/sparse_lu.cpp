@@ -0,0 +1,351 @@
+#include "sparse_lu.h"
+
+#include "sparse_matrix.h"
+
+using s21::gauss::SparseLu;
+
+// Methods
+void SparseLu::Analyze(const SparseMatrix& matrix, const int threads_quantity) {
+  size_ = matrix.GetRows();
+  row_offsets_ = matrix.GetRowOffsets();
+  columns_ = matrix.GetColumns();
+  std::vector<std::vector<size_type>> adjacency = BuildAdjacency();
+  OrderByMinimumDegree(adjacency);
+  BuildEliminationTree(adjacency);
+  BuildEntryMaps();
+  BuildSchedule(threads_quantity);
+  lower_.assign(pattern_.size(), 0);
+  upper_.assign(pattern_.size(), 0);
+  diagonal_.assign(size_, 0);
+  work_solution_.assign(size_, 0);
+  int workers_quantity = std::max<int>(1, subtree_schedule_.size());
+  work_lower_.assign(workers_quantity, std::vector<value_type>(size_, 0));
+  work_upper_.assign(workers_quantity, std::vector<value_type>(size_, 0));
+  errors_.assign(workers_quantity, nullptr);
+}
+
+bool SparseLu::Matches(const SparseMatrix& matrix) const {
+  return size_ == matrix.GetRows() &&
+         row_offsets_ == matrix.GetRowOffsets() &&
+         columns_ == matrix.GetColumns();
+}
+
+void SparseLu::Factorize(const SparseMatrix& matrix) {
+  S21_TRACE_SCOPE("factorize");
+  for (size_type column = 0; column < size_; ++column) {
+    FactorizeColumn(matrix.GetValues(), column, &work_lower_[0],
+                    &work_upper_[0]);
+  }
+}
+
+// Columns of one subtree only read columns of the same subtree, so every
+// worker factors its own subtrees and the columns above them go last
+void SparseLu::FactorizeInParallel(const SparseMatrix& matrix) {
+  S21_TRACE_SCOPE("factorize");
+  std::vector<std::thread> threads;
+  for (size_t worker = 0; worker < subtree_schedule_.size(); ++worker) {
+    if (subtree_schedule_[worker].empty()) continue;
+    threads.push_back(std::thread(&SparseLu::FactorizeColumns, this,
+                                  std::cref(matrix),
+                                  std::cref(subtree_schedule_[worker]),
+                                  static_cast<int>(worker)));
+  }
+  {
+    S21_TRACE_SCOPE("join");
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+  RethrowWorkerError();
+  FactorizeColumns(matrix, top_schedule_, 0);
+  RethrowWorkerError();
+}
+
+void SparseLu::Solve(const std::vector<value_type>& rhs,
+                     std::vector<value_type>* solution) {
+  S21_TRACE_SCOPE("triangular solve");
+  std::vector<value_type>& x = work_solution_;
+  for (size_type i = 0; i < size_; ++i) {
+    x[i] = rhs[permutation_[i]];
+  }
+  for (size_type j = 0; j < size_; ++j) {
+    for (size_type p = pattern_offsets_[j]; p < pattern_offsets_[j + 1]; ++p) {
+      x[pattern_[p]] -= lower_[p] * x[j];
+    }
+  }
+  for (size_type j = size_ - 1; j >= 0; --j) {
+    value_type sum = x[j];
+    for (size_type p = pattern_offsets_[j]; p < pattern_offsets_[j + 1]; ++p) {
+      sum -= upper_[p] * x[pattern_[p]];
+    }
+    x[j] = sum / diagonal_[j];
+  }
+  solution->resize(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    (*solution)[permutation_[i]] = x[i];
+  }
+}
+
+// Getters
+typename SparseLu::size_type SparseLu::GetFactorsNonZerosQuantity() const {
+  return 2 * pattern_.size() + size_;
+}
+
+const std::vector<typename SparseLu::size_type>& SparseLu::GetPermutation()
+    const {
+  return permutation_;
+}
+
+// Private functions
+std::vector<std::vector<typename SparseLu::size_type>>
+SparseLu::BuildAdjacency() const {
+  std::vector<std::vector<size_type>> adjacency(size_);
+  for (size_type row = 0; row < size_; ++row) {
+    for (size_type p = row_offsets_[row]; p < row_offsets_[row + 1]; ++p) {
+      size_type column = columns_[p];
+      if (column != row) {
+        adjacency[row].push_back(column);
+        adjacency[column].push_back(row);
+      }
+    }
+  }
+  for (std::vector<size_type>& neighbours : adjacency) {
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()),
+                     neighbours.end());
+  }
+  return adjacency;
+}
+
+// Eliminates the vertex of minimum degree and turns its neighbours into a
+// clique, which is exactly the fill its elimination creates
+void SparseLu::OrderByMinimumDegree(
+    std::vector<std::vector<size_type>> adjacency) {
+  permutation_.clear();
+  std::set<std::pair<size_type, size_type>> queue;
+  for (size_type vertex = 0; vertex < size_; ++vertex) {
+    queue.insert(std::make_pair(adjacency[vertex].size(), vertex));
+  }
+  std::vector<size_type> merged;
+  while (!queue.empty()) {
+    size_type vertex = queue.begin()->second;
+    queue.erase(queue.begin());
+    permutation_.push_back(vertex);
+    const std::vector<size_type>& clique = adjacency[vertex];
+    for (size_type neighbour : clique) {
+      std::vector<size_type>& neighbours = adjacency[neighbour];
+      queue.erase(std::make_pair(neighbours.size(), neighbour));
+      merged.clear();
+      std::set_union(neighbours.begin(), neighbours.end(), clique.begin(),
+                     clique.end(), std::back_inserter(merged));
+      merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                  [vertex, neighbour](size_type v) {
+                                    return v == vertex || v == neighbour;
+                                  }),
+                   merged.end());
+      neighbours.swap(merged);
+      queue.insert(std::make_pair(neighbours.size(), neighbour));
+    }
+    std::vector<size_type>().swap(adjacency[vertex]);
+  }
+}
+
+void SparseLu::BuildEliminationTree(
+    const std::vector<std::vector<size_type>>& adjacency) {
+  std::vector<size_type> inverse(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    inverse[permutation_[i]] = i;
+  }
+  parent_.assign(size_, -1);
+  std::vector<size_type> ancestor(size_, -1);
+  for (size_type i = 0; i < size_; ++i) {
+    for (size_type neighbour : adjacency[permutation_[i]]) {
+      size_type k = inverse[neighbour];
+      while (k != -1 && k < i) {
+        size_type next = ancestor[k];
+        ancestor[k] = i;
+        if (next == -1) {
+          parent_[k] = i;
+        }
+        k = next;
+      }
+    }
+  }
+
+  // Row i of L covers every node on the paths from its entries up to i
+  row_patterns_.assign(size_, std::vector<size_type>());
+  std::vector<size_type> mark(size_, -1);
+  std::vector<std::vector<size_type>> column_patterns(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    mark[i] = i;
+    for (size_type neighbour : adjacency[permutation_[i]]) {
+      size_type k = inverse[neighbour];
+      if (k > i) continue;
+      while (mark[k] != i) {
+        row_patterns_[i].push_back(k);
+        column_patterns[k].push_back(i);
+        mark[k] = i;
+        k = parent_[k];
+      }
+    }
+    std::sort(row_patterns_[i].begin(), row_patterns_[i].end());
+  }
+  pattern_offsets_.assign(1, 0);
+  pattern_.clear();
+  for (size_type j = 0; j < size_; ++j) {
+    pattern_.insert(pattern_.end(), column_patterns[j].begin(),
+                    column_patterns[j].end());
+    pattern_offsets_.push_back(pattern_.size());
+  }
+}
+
+void SparseLu::BuildEntryMaps() {
+  std::vector<size_type> inverse(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    inverse[permutation_[i]] = i;
+  }
+  lower_entries_.assign(size_, std::vector<Entry>());
+  upper_entries_.assign(size_, std::vector<Entry>());
+  for (size_type row = 0; row < size_; ++row) {
+    for (size_type p = row_offsets_[row]; p < row_offsets_[row + 1]; ++p) {
+      size_type i = inverse[row], j = inverse[columns_[p]];
+      if (i >= j) {
+        lower_entries_[j].push_back(Entry{i, p});
+      } else {
+        upper_entries_[i].push_back(Entry{j, p});
+      }
+    }
+  }
+}
+
+// Splits the largest subtree until there are enough subtrees to balance the
+// workers; split roots form the top part that is factored last
+void SparseLu::BuildSchedule(const int threads_quantity) {
+  int workers_quantity = std::max(1, threads_quantity);
+  size_type target = workers_quantity * kSubtreesPerThread;
+  std::vector<std::vector<size_type>> children(size_);
+  std::vector<size_type> subtree_sizes(size_, 1);
+  std::vector<size_type> candidates;
+  for (size_type i = 0; i < size_; ++i) {
+    if (parent_[i] == -1) {
+      candidates.push_back(i);
+    } else {
+      children[parent_[i]].push_back(i);
+      subtree_sizes[parent_[i]] += subtree_sizes[i];
+    }
+  }
+  top_schedule_.clear();
+  while (static_cast<size_type>(candidates.size()) < target) {
+    std::vector<size_type>::iterator largest = std::max_element(
+        candidates.begin(), candidates.end(), [&](size_type l, size_type r) {
+          return subtree_sizes[l] < subtree_sizes[r];
+        });
+    size_type root = *largest;
+    if (children[root].empty() || subtree_sizes[root] * target <= size_) {
+      break;
+    }
+    candidates.erase(largest);
+    top_schedule_.push_back(root);
+    candidates.insert(candidates.end(), children[root].begin(),
+                      children[root].end());
+  }
+  std::sort(top_schedule_.begin(), top_schedule_.end());
+
+  std::sort(candidates.begin(), candidates.end(),
+            [&](size_type l, size_type r) {
+              return subtree_sizes[l] > subtree_sizes[r];
+            });
+  subtree_schedule_.assign(workers_quantity, std::vector<size_type>());
+  std::vector<size_type> loads(workers_quantity, 0);
+  std::vector<size_type> stack;
+  for (size_type root : candidates) {
+    int worker = std::min_element(loads.begin(), loads.end()) - loads.begin();
+    loads[worker] += subtree_sizes[root];
+    stack.push_back(root);
+    while (!stack.empty()) {
+      size_type node = stack.back();
+      stack.pop_back();
+      subtree_schedule_[worker].push_back(node);
+      stack.insert(stack.end(), children[node].begin(), children[node].end());
+    }
+  }
+  for (std::vector<size_type>& columns : subtree_schedule_) {
+    std::sort(columns.begin(), columns.end());
+  }
+}
+
+void SparseLu::FactorizeColumns(const SparseMatrix& matrix,
+                                const std::vector<size_type>& columns,
+                                const int worker) {
+  S21_TRACE_SCOPE("columns");
+  try {
+    for (size_type column : columns) {
+      FactorizeColumn(matrix.GetValues(), column, &work_lower_[worker],
+                      &work_upper_[worker]);
+    }
+  } catch (...) {
+    errors_[worker] = std::current_exception();
+  }
+}
+
+void SparseLu::FactorizeColumn(const std::vector<value_type>& values,
+                               const size_type column,
+                               std::vector<value_type>* wl,
+                               std::vector<value_type>* wu) {
+  value_type diagonal = 0;
+  for (const Entry& entry : lower_entries_[column]) {
+    if (entry.index == column) {
+      diagonal += values[entry.value_index];
+    } else {
+      (*wl)[entry.index] += values[entry.value_index];
+    }
+  }
+  for (const Entry& entry : upper_entries_[column]) {
+    (*wu)[entry.index] += values[entry.value_index];
+  }
+  for (size_type k : row_patterns_[column]) {
+    size_type position = FindInPattern(k, column);
+    value_type l_jk = lower_[position], u_kj = upper_[position];
+    diagonal -= l_jk * u_kj;
+    for (size_type p = position + 1; p < pattern_offsets_[k + 1]; ++p) {
+      (*wl)[pattern_[p]] -= lower_[p] * u_kj;
+      (*wu)[pattern_[p]] -= l_jk * upper_[p];
+    }
+  }
+  if (diagonal == 0) {
+    for (size_type p = pattern_offsets_[column];
+         p < pattern_offsets_[column + 1]; ++p) {
+      (*wl)[pattern_[p]] = 0;
+      (*wu)[pattern_[p]] = 0;
+    }
+    throw s21::ZeroPivot();
+  }
+  diagonal_[column] = diagonal;
+  for (size_type p = pattern_offsets_[column]; p < pattern_offsets_[column + 1];
+       ++p) {
+    size_type row = pattern_[p];
+    lower_[p] = (*wl)[row] / diagonal;
+    upper_[p] = (*wu)[row];
+    (*wl)[row] = 0;
+    (*wu)[row] = 0;
+  }
+}
+
+typename SparseLu::size_type SparseLu::FindInPattern(
+    const size_type column, const size_type row) const {
+  std::vector<size_type>::const_iterator first =
+      pattern_.cbegin() + pattern_offsets_[column];
+  std::vector<size_type>::const_iterator last =
+      pattern_.cbegin() + pattern_offsets_[column + 1];
+  return std::lower_bound(first, last, row) - pattern_.cbegin();
+}
+
+void SparseLu::RethrowWorkerError() {
+  for (std::exception_ptr& error : errors_) {
+    if (error != nullptr) {
+      std::exception_ptr thrown = error;
+      std::fill(errors_.begin(), errors_.end(), nullptr);
+      std::rethrow_exception(thrown);
+    }
+  }
+}
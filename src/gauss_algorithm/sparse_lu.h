@@ -0,0 +1,98 @@
+#ifndef GAUSS_SPARSE_LU_H_
+#define GAUSS_SPARSE_LU_H_
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../exceptions/exceptions.h"
+#include "../tracing/tracing.h"
+
+namespace s21 {
+
+namespace gauss {
+
+constexpr int kSubtreesPerThread = 4;
+
+class SparseMatrix;
+
+// Sparse LU without pivoting on the symmetrized pattern of A + A^T.
+// Analyze computes a minimum degree ordering, the elimination tree and the
+// structure of the factors once; Factorize can then be repeated for any
+// system with the same pattern. The numeric phase is left-looking, so
+// disjoint subtrees of the elimination tree are factored in parallel.
+class SparseLu {
+ public:
+  using value_type = double;
+  using size_type = int;
+
+ public:
+  // Methods
+  void Analyze(const SparseMatrix& matrix, const int threads_quantity);
+  bool Matches(const SparseMatrix& matrix) const;
+  void Factorize(const SparseMatrix& matrix);
+  void FactorizeInParallel(const SparseMatrix& matrix);
+  void Solve(const std::vector<value_type>& rhs,
+             std::vector<value_type>* solution);
+
+  // Getters
+  size_type GetFactorsNonZerosQuantity() const;
+  const std::vector<size_type>& GetPermutation() const;
+
+ private:
+  struct Entry {
+    size_type index;
+    size_type value_index;
+  };
+
+  size_type size_ = 0;
+  std::vector<size_type> row_offsets_;
+  std::vector<size_type> columns_;
+
+  // Symbolic phase
+  std::vector<size_type> permutation_;  // new index -> original index
+  std::vector<size_type> parent_;       // elimination tree
+  std::vector<size_type> pattern_offsets_;
+  std::vector<size_type> pattern_;  // rows of L(:, j) = columns of U(j, :)
+  std::vector<std::vector<size_type>> row_patterns_;
+  std::vector<std::vector<Entry>> lower_entries_;
+  std::vector<std::vector<Entry>> upper_entries_;
+  std::vector<std::vector<size_type>> subtree_schedule_;
+  std::vector<size_type> top_schedule_;
+
+  // Numeric phase
+  std::vector<value_type> lower_;
+  std::vector<value_type> upper_;
+  std::vector<value_type> diagonal_;
+  std::vector<std::vector<value_type>> work_lower_;
+  std::vector<std::vector<value_type>> work_upper_;
+  std::vector<value_type> work_solution_;
+  std::vector<std::exception_ptr> errors_;
+
+ private:
+  std::vector<std::vector<size_type>> BuildAdjacency() const;
+  void OrderByMinimumDegree(std::vector<std::vector<size_type>> adjacency);
+  void BuildEliminationTree(
+      const std::vector<std::vector<size_type>>& adjacency);
+  void BuildEntryMaps();
+  void BuildSchedule(const int threads_quantity);
+  void FactorizeColumns(const SparseMatrix& matrix,
+                        const std::vector<size_type>& columns,
+                        const int worker);
+  void FactorizeColumn(const std::vector<value_type>& values,
+                       const size_type column, std::vector<value_type>* wl,
+                       std::vector<value_type>* wu);
+  void RethrowWorkerError();
+  size_type FindInPattern(const size_type column, const size_type row) const;
+};
+
+}  // namespace gauss
+
+}  // namespace s21
+
+#endif  // GAUSS_SPARSE_LU_H_
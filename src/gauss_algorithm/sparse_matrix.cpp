@@ -0,0 +1,183 @@
+#include "sparse_matrix.h"
+
+using s21::gauss::SparseMatrix;
+
+// Constructors
+SparseMatrix::SparseMatrix(const size_type rows,
+                           const std::vector<size_type>& row_offsets,
+                           const std::vector<size_type>& columns,
+                           const std::vector<value_type>& values,
+                           const std::vector<value_type>& rhs)
+    : rows_(rows),
+      threads_quantity_(std::max(1u, std::thread::hardware_concurrency())),
+      row_offsets_(row_offsets),
+      columns_(columns),
+      values_(values),
+      rhs_(rhs) {
+  CheckStructure();
+}
+
+SparseMatrix::SparseMatrix(const s21::Matrix& matrix)
+    : rows_(matrix.GetRows()),
+      threads_quantity_(std::max(1u, std::thread::hardware_concurrency())) {
+  if (matrix.GetColumns() - matrix.GetRows() != 1) {
+    throw s21::InvalidGaussMatrix();
+  }
+  row_offsets_.push_back(0);
+  for (size_type i = 0; i < rows_; ++i) {
+    for (size_type j = 0; j < rows_; ++j) {
+      if (matrix(i, j) != 0) {
+        columns_.push_back(j);
+        values_.push_back(matrix(i, j));
+      }
+    }
+    row_offsets_.push_back(columns_.size());
+    rhs_.push_back(matrix(i, rows_));
+  }
+}
+
+// Methods
+typename SparseMatrix::result_type SparseMatrix::SolveSequentially(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&SparseMatrix::Factorize, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+typename SparseMatrix::result_type SparseMatrix::SolveInParallel(
+    const int iterations_quantity) {
+  std::function<void()> solving_method =
+      std::bind(&SparseMatrix::ParallelFactorize, this);
+  return Solve(solving_method, iterations_quantity);
+}
+
+bool SparseMatrix::IsSparse(const s21::Matrix& matrix) {
+  if (matrix.GetRows() < kMinimumSparseRows ||
+      matrix.GetColumns() - matrix.GetRows() != 1) {
+    return false;
+  }
+  int64_t non_zeros_quantity = 0;
+  for (size_type i = 0; i < matrix.GetRows(); ++i) {
+    for (size_type j = 0; j < matrix.GetRows(); ++j) {
+      non_zeros_quantity += matrix(i, j) != 0;
+    }
+  }
+  int64_t size = matrix.GetRows();
+  return non_zeros_quantity * kSparseDensityRatio <= size * size;
+}
+
+// Writes the non-zeros and the right-hand side into a zeroed n x (n + 1)
+// matrix
+void SparseMatrix::CopyTo(s21::Matrix* matrix) const {
+  for (size_type i = 0; i < rows_; ++i) {
+    for (size_type k = row_offsets_[i]; k < row_offsets_[i + 1]; ++k) {
+      (*matrix)(i, columns_[k]) = values_[k];
+    }
+    (*matrix)(i, rows_) = rhs_[i];
+  }
+}
+
+// Setters
+void SparseMatrix::SetValues(const std::vector<value_type>& values,
+                             const std::vector<value_type>& rhs) {
+  if (values.size() != values_.size() || rhs.size() != rhs_.size()) {
+    throw s21::InvalidMatrixSizes();
+  }
+  values_ = values;
+  rhs_ = rhs;
+}
+
+void SparseMatrix::SetThreadsQuantity(const int threads_quantity) {
+  if (threads_quantity_ != threads_quantity) {
+    threads_quantity_ = std::max(1, threads_quantity);
+    lu_ = SparseLu();
+  }
+}
+
+// Getters
+typename SparseMatrix::size_type SparseMatrix::GetRows() const {
+  return rows_;
+}
+
+typename SparseMatrix::size_type SparseMatrix::GetNonZerosQuantity() const {
+  return values_.size();
+}
+
+const std::vector<typename SparseMatrix::size_type>&
+SparseMatrix::GetRowOffsets() const {
+  return row_offsets_;
+}
+
+const std::vector<typename SparseMatrix::size_type>& SparseMatrix::GetColumns()
+    const {
+  return columns_;
+}
+
+const std::vector<typename SparseMatrix::value_type>& SparseMatrix::GetValues()
+    const {
+  return values_;
+}
+
+const std::vector<typename SparseMatrix::value_type>& SparseMatrix::GetRhs()
+    const {
+  return rhs_;
+}
+
+// Private functions
+
+// The symbolic analysis is done once per sparsity pattern, only the numeric
+// factorization and the triangular solves are timed
+typename SparseMatrix::result_type SparseMatrix::Solve(
+    std::function<void()> solving_method, const int iterations_quantity) {
+  if (!lu_.Matches(*this)) {
+    lu_.Analyze(*this, threads_quantity_);
+  }
+  result_.Reset();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    solving_method();
+    lu_.Solve(rhs_, &solution_);
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+  }
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(solution_);
+  return result_;
+}
+
+void SparseMatrix::Factorize() { lu_.Factorize(*this); }
+
+void SparseMatrix::ParallelFactorize() { lu_.FactorizeInParallel(*this); }
+
+// The factorization walks each row in column order, so the offsets must not
+// decrease and the columns of a row must be sorted and unique
+void SparseMatrix::CheckStructure() const {
+  if (rows_ <= 0 || static_cast<size_type>(row_offsets_.size()) != rows_ + 1 ||
+      static_cast<size_type>(rhs_.size()) != rows_ ||
+      columns_.size() != values_.size() ||
+      row_offsets_.front() != 0 ||
+      row_offsets_.back() != static_cast<size_type>(columns_.size())) {
+    throw s21::InvalidMatrixSizes();
+  }
+  for (size_type i = 0; i < rows_; ++i) {
+    if (row_offsets_[i] > row_offsets_[i + 1]) {
+      throw s21::InvalidMatrixSizes();
+    }
+  }
+  for (size_type i = 0; i < rows_; ++i) {
+    for (size_type k = row_offsets_[i]; k < row_offsets_[i + 1]; ++k) {
+      if (columns_[k] < 0 || columns_[k] >= rows_ ||
+          (k > row_offsets_[i] && columns_[k] <= columns_[k - 1])) {
+        throw s21::InvalidMatrixSizes();
+      }
+    }
+  }
+}
@@ -0,0 +1,80 @@
+#ifndef GAUSS_SPARSE_MATRIX_H_
+#define GAUSS_SPARSE_MATRIX_H_
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+#include "../timer/timer.h"
+#include "sparse_lu.h"
+
+namespace s21 {
+
+namespace gauss {
+
+// A system is stored as sparse when at most a tenth of its entries are set
+constexpr int kSparseDensityRatio = 10;
+constexpr int kMinimumSparseRows = 32;
+
+// Augmented n x (n + 1) system with the n x n part in CSR form
+class SparseMatrix {
+ public:
+  using value_type = double;
+  using size_type = int;
+  using solution_type = std::vector<value_type>;
+  using result_type = AlgorithmResult<solution_type>;
+
+ public:
+  // Constructors
+  SparseMatrix(const size_type rows, const std::vector<size_type>& row_offsets,
+               const std::vector<size_type>& columns,
+               const std::vector<value_type>& values,
+               const std::vector<value_type>& rhs);
+  SparseMatrix(const s21::Matrix& matrix);
+
+  // Methods
+  result_type SolveSequentially(const int iterations_quantity);
+  result_type SolveInParallel(const int iterations_quantity);
+  static bool IsSparse(const s21::Matrix& matrix);
+  void CopyTo(s21::Matrix* matrix) const;
+
+  // Setters
+  void SetValues(const std::vector<value_type>& values,
+                 const std::vector<value_type>& rhs);
+  void SetThreadsQuantity(const int threads_quantity);
+
+  // Getters
+  size_type GetRows() const;
+  size_type GetNonZerosQuantity() const;
+  const std::vector<size_type>& GetRowOffsets() const;
+  const std::vector<size_type>& GetColumns() const;
+  const std::vector<value_type>& GetValues() const;
+  const std::vector<value_type>& GetRhs() const;
+
+ private:
+  size_type rows_;
+  int threads_quantity_;
+  std::vector<size_type> row_offsets_;
+  std::vector<size_type> columns_;
+  std::vector<value_type> values_;
+  std::vector<value_type> rhs_;
+  SparseLu lu_;
+  solution_type solution_;
+  result_type result_;
+
+ private:
+  result_type Solve(std::function<void()> solving_method,
+                    const int iterations_quantity);
+  void Factorize();
+  void ParallelFactorize();
+  void CheckStructure() const;
+};
+
+}  // namespace gauss
+
+}  // namespace s21
+
+#endif  // GAUSS_SPARSE_MATRIX_H_
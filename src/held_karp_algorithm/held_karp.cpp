@@ -0,0 +1,236 @@
+#include "held_karp.h"
+
+using s21::held_karp::HeldKarp;
+
+typename HeldKarp::result_type
+HeldKarp::SolveTravelingSalesmanProblemSequently(
+    const Matrix& graph, const int iterations_quantity) {
+  threads_quantity_ = 1;
+  Solve(graph, iterations_quantity);
+  return result_;
+}
+
+typename HeldKarp::result_type
+HeldKarp::SolveTravelingSalesmanProblemInParallel(
+    const Matrix& graph, const int iterations_quantity) {
+  threads_quantity_ = kThreadsQuantity;
+  Solve(graph, iterations_quantity);
+  return result_;
+}
+
+// The layers are released after the solve, they take most of the memory
+void HeldKarp::Solve(const Matrix& graph, const int iterations_quantity) {
+  result_.Reset();
+  tsm_result_ = solution_type();
+  Timer total_time_timer;
+  Timer average_time_timer;
+  PerfCounters iteration_counters(true);
+  total_time_timer.Begin();
+  Setup(graph);
+  for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
+    average_time_timer.Begin();
+    FindTour();
+    s21::TimeRange timestamp = average_time_timer.Timestamp();
+    result_.AddTimestamp(timestamp);
+    result_.AddCounters(iteration_counters.Sample());
+    result_.AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
+  }
+  previous_costs_ = std::vector<double>();
+  costs_ = std::vector<double>();
+  parents_ = std::vector<std::vector<uint8_t>>();
+  s21::TimeRange timestamp = total_time_timer.Timestamp();
+  result_.SetTotalExecutionTime(timestamp);
+  result_.SetSolution(tsm_result_);
+}
+
+void HeldKarp::Setup(const Matrix& graph) {
+  if (graph.GetRows() != graph.GetColumns() || graph.GetRows() < 2 ||
+      graph.GetRows() > kMaxVerticesQuantity) {
+    throw s21::InvalidHeldKarpSize();
+  }
+  size_ = graph.GetRows();
+  subset_bits_ = size_ - 1;
+  weights_.resize(size_ * size_);
+  for (size_type i = 0; i < size_; ++i) {
+    for (size_type j = 0; j < size_; ++j) {
+      weights_[i * size_ + j] =
+          graph(i, j) != ant::kDefaultCost ? graph(i, j) : INFINITY;
+    }
+  }
+  SetupBinomials();
+}
+
+void HeldKarp::SetupBinomials() {
+  binomials_.assign(subset_bits_ + 1,
+                    std::vector<int64_t>(subset_bits_ + 1, 0));
+  for (int n = 0; n <= subset_bits_; ++n) {
+    binomials_[n][0] = 1;
+    for (int k = 1; k <= n; ++k) {
+      binomials_[n][k] = binomials_[n - 1][k - 1] + binomials_[n - 1][k];
+    }
+  }
+}
+
+// A graph without a Hamiltonian cycle leaves the distance infinite
+void HeldKarp::FindTour() {
+  parents_.assign(subset_bits_ + 1, std::vector<uint8_t>());
+  for (int bits_quantity = 1; bits_quantity <= subset_bits_; ++bits_quantity) {
+    previous_costs_.swap(costs_);
+    ProcessLayer(bits_quantity);
+  }
+  double distance = INFINITY;
+  int last_position = 0;
+  for (int position = 0; position < subset_bits_; ++position) {
+    double cost = costs_[position] + GetWeight(position + 1, 0);
+    if (cost < distance) {
+      distance = cost;
+      last_position = position;
+    }
+  }
+  tsm_result_ = solution_type();
+  if (distance == INFINITY) {
+    return;
+  }
+  tsm_result_.distance = distance;
+  RestoreTour(last_position);
+}
+
+void HeldKarp::ProcessLayer(const int bits_quantity) {
+  S21_TRACE_SCOPE("layer");
+  int64_t subsets_quantity = binomials_[subset_bits_][bits_quantity];
+  costs_.resize(subsets_quantity * bits_quantity);
+  parents_[bits_quantity].resize(subsets_quantity * bits_quantity);
+  int threads_quantity = static_cast<int>(
+      std::min<int64_t>(threads_quantity_, subsets_quantity));
+  if (threads_quantity == 1) {
+    ProcessSubsets(bits_quantity, 0, subsets_quantity);
+    return;
+  }
+  std::vector<std::thread> threads;
+  ReserveThreadCounters(&thread_counters_, threads_quantity);
+  for (int i = 1; i <= threads_quantity; ++i) {
+    threads.push_back(std::thread([this, bits_quantity, subsets_quantity,
+                                   threads_quantity, i]() {
+      ScopedThreadCounters counters(&thread_counters_[i - 1]);
+      S21_TRACE_SCOPE("subsets");
+      ProcessSubsets(bits_quantity,
+                     subsets_quantity * (i - 1) / threads_quantity,
+                     subsets_quantity * i / threads_quantity);
+    }));
+  }
+  S21_TRACE_SCOPE("join");
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// Subsets of one size come in increasing order, which is the order of their
+// ranks. Removing the vertex at position p from a subset of rank
+// sum C(b_i, i) lowers the index of every later vertex by one, so the rank
+// of the smaller subset is a prefix of the sum plus a shifted suffix
+void HeldKarp::ProcessSubsets(const int bits_quantity, const int64_t first_rank,
+                              const int64_t last_rank) {
+  int bits[kMaxVerticesQuantity];
+  int64_t prefixes[kMaxVerticesQuantity], suffixes[kMaxVerticesQuantity];
+  std::vector<uint8_t>& parents = parents_[bits_quantity];
+  uint32_t subset = Unrank(first_rank, bits_quantity);
+  for (int64_t rank = first_rank; rank < last_rank; ++rank) {
+    int quantity = 0;
+    for (int bit = 0; bit < subset_bits_; ++bit) {
+      if ((subset >> bit) & 1) {
+        bits[quantity++] = bit;
+      }
+    }
+    prefixes[0] = 0;
+    for (int p = 1; p < bits_quantity; ++p) {
+      prefixes[p] = prefixes[p - 1] + binomials_[bits[p - 1]][p];
+    }
+    suffixes[bits_quantity - 1] = 0;
+    for (int p = bits_quantity - 2; p >= 0; --p) {
+      suffixes[p] = suffixes[p + 1] + binomials_[bits[p + 1]][p + 1];
+    }
+    for (int p = 0; p < bits_quantity; ++p) {
+      int vertex = bits[p] + 1;
+      int64_t index = rank * bits_quantity + p;
+      if (bits_quantity == 1) {
+        costs_[index] = GetWeight(0, vertex);
+        parents[index] = 0;
+        continue;
+      }
+      const double* previous_costs =
+          &previous_costs_[(prefixes[p] + suffixes[p]) * (bits_quantity - 1)];
+      double best_cost = INFINITY;
+      int best_parent = 0;
+      for (int q = 0; q < bits_quantity - 1; ++q) {
+        int from = bits[q < p ? q : q + 1] + 1;
+        double cost = previous_costs[q] + weights_[from * size_ + vertex];
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_parent = from;
+        }
+      }
+      costs_[index] = best_cost;
+      parents[index] = static_cast<uint8_t>(best_parent);
+    }
+    uint32_t lowest = subset & (~subset + 1);
+    uint32_t ripple = subset + lowest;
+    subset = (((ripple ^ subset) >> 2) / lowest) | ripple;
+  }
+}
+
+// Walks the parents back from the full subset, the tour is closed at 0
+void HeldKarp::RestoreTour(const int last_position) {
+  std::vector<int> reversed_tour;
+  uint32_t subset = (uint32_t{1} << subset_bits_) - 1;
+  int vertex = last_position + 1, position = last_position;
+  for (int bits_quantity = subset_bits_; bits_quantity > 0; --bits_quantity) {
+    reversed_tour.push_back(vertex);
+    int parent =
+        parents_[bits_quantity][Rank(subset) * bits_quantity + position];
+    subset &= ~(uint32_t{1} << (vertex - 1));
+    if (parent == 0) {
+      break;
+    }
+    position = 0;
+    for (int bit = 0; bit < parent - 1; ++bit) {
+      position += (subset >> bit) & 1;
+    }
+    vertex = parent;
+  }
+  std::vector<int>& tour = tsm_result_.vertices;
+  tour.assign(1, 0);
+  tour.insert(tour.end(), reversed_tour.rbegin(), reversed_tour.rend());
+  tour.push_back(0);
+}
+
+uint32_t HeldKarp::Unrank(int64_t rank, const int bits_quantity) const {
+  uint32_t subset = 0;
+  int bit = subset_bits_ - 1;
+  for (int i = bits_quantity; i > 0; --i) {
+    while (binomials_[bit][i] > rank) {
+      --bit;
+    }
+    rank -= binomials_[bit][i];
+    subset |= uint32_t{1} << bit;
+    --bit;
+  }
+  return subset;
+}
+
+int64_t HeldKarp::Rank(const uint32_t subset) const {
+  int64_t rank = 0;
+  int index = 0;
+  for (int bit = 0; bit < subset_bits_; ++bit) {
+    if ((subset >> bit) & 1) {
+      rank += binomials_[bit][++index];
+    }
+  }
+  return rank;
+}
+
+double HeldKarp::GetWeight(const int from, const int to) const {
+  return weights_[from * size_ + to];
+}
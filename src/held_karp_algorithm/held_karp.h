@@ -0,0 +1,74 @@
+#ifndef HELD_KARP_ALGORITHM_HELD_KARP_H_
+#define HELD_KARP_ALGORITHM_HELD_KARP_H_
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../ant_algorithm/ant_algorithm.h"
+#include "../exceptions/exceptions.h"
+#include "../matrix.h"
+#include "../timer/timer.h"
+#include "../tracing/tracing.h"
+
+namespace s21 {
+
+namespace held_karp {
+
+constexpr int kMaxVerticesQuantity = 25;
+constexpr int kThreadsQuantity = 8;
+
+// Exact solver for the graphs of AntAlgorithm, used as the ground truth for
+// its tours. Tours start at vertex 0 and the dynamic programming runs over
+// the subsets of the other n - 1 vertices layer by layer in the order of
+// their size. Only two layers of costs are kept, each subset stores the
+// costs of its own vertices at the rank of the subset among those of the
+// same size, and the layers are split between threads. The parents of all
+// layers, one byte per entry, restore the tour. At 25 vertices this takes
+// about 800 MB.
+class HeldKarp {
+ public:
+  using size_type = Matrix::size_type;
+  using solution_type = ant::TsmResult;
+  using result_type = AlgorithmResult<solution_type>;
+
+ public:
+  result_type SolveTravelingSalesmanProblemSequently(
+      const Matrix& graph, const int iterations_quantity);
+  result_type SolveTravelingSalesmanProblemInParallel(
+      const Matrix& graph, const int iterations_quantity);
+
+ private:
+  size_type size_ = 0;
+  int subset_bits_ = 0;  // bit b is vertex b + 1
+  int threads_quantity_ = 1;
+  std::vector<double> weights_;  // INFINITY without an edge
+  std::vector<std::vector<int64_t>> binomials_;
+  std::vector<double> previous_costs_;
+  std::vector<double> costs_;
+  std::vector<std::vector<uint8_t>> parents_;  // per subset size
+  solution_type tsm_result_;
+  result_type result_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
+
+ private:
+  void Solve(const Matrix& graph, const int iterations_quantity);
+  void Setup(const Matrix& graph);
+  void SetupBinomials();
+  void FindTour();
+  void ProcessLayer(const int bits_quantity);
+  void ProcessSubsets(const int bits_quantity, const int64_t first_rank,
+                      const int64_t last_rank);
+  void RestoreTour(const int last_position);
+  uint32_t Unrank(int64_t rank, const int bits_quantity) const;
+  int64_t Rank(const uint32_t subset) const;
+  double GetWeight(const int from, const int to) const;
+};
+
+}  // namespace held_karp
+
+}  // namespace s21
+
+#endif  // HELD_KARP_ALGORITHM_HELD_KARP_H_
@@ -0,0 +1,79 @@
+#include "histogram.h"
+
+using s21::Histogram;
+
+// Methods
+
+// A negative value is recorded as 0
+void Histogram::Record(const int64_t value) {
+  int64_t clamped = std::max<int64_t>(0, value);
+  ++counts_[GetIndex(clamped)];
+  minimum_ = count_ == 0 ? clamped : std::min(minimum_, clamped);
+  maximum_ = count_ == 0 ? clamped : std::max(maximum_, clamped);
+  ++count_;
+  double delta = clamped - mean_;
+  mean_ += delta / count_;
+  squared_deviations_ += delta * (clamped - mean_);
+}
+
+void Histogram::Reset() { *this = Histogram(); }
+
+// The highest value of the bucket that holds the value of the given rank,
+// clamped to the exact extremes. 0 without values
+int64_t Histogram::CalculatePercentile(const double percentile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  double share = std::min(100.0, std::max(0.0, percentile)) / 100;
+  int64_t rank = std::max<int64_t>(1, std::ceil(share * count_));
+  int64_t cumulative = 0;
+  for (int index = 0; index < kBucketsQuantity; ++index) {
+    cumulative += counts_[index];
+    if (cumulative >= rank) {
+      return std::min(maximum_,
+                      std::max(minimum_, GetHighestEquivalent(index)));
+    }
+  }
+  return maximum_;
+}
+
+// Getters
+int64_t Histogram::GetCount() const { return count_; }
+
+int64_t Histogram::GetMinimum() const { return minimum_; }
+
+int64_t Histogram::GetMaximum() const { return maximum_; }
+
+double Histogram::GetMean() const { return mean_; }
+
+double Histogram::GetStandardDeviation() const {
+  return count_ == 0 ? 0 : std::sqrt(squared_deviations_ / count_);
+}
+
+// Private functions
+
+// A value of the bucket of magnitude m is shifted right by m to land in
+// [kHalfSubBucketsQuantity, kSubBucketsQuantity)
+int Histogram::GetIndex(const int64_t value) const {
+  if (value < kSubBucketsQuantity) {
+    return static_cast<int>(value);
+  }
+  int magnitude = 0;
+  while ((value >> magnitude) >= kSubBucketsQuantity) {
+    ++magnitude;
+  }
+  int index = kSubBucketsQuantity + (magnitude - 1) * kHalfSubBucketsQuantity +
+              static_cast<int>(value >> magnitude) - kHalfSubBucketsQuantity;
+  return std::min(index, kBucketsQuantity - 1);
+}
+
+int64_t Histogram::GetHighestEquivalent(const int index) const {
+  if (index < kSubBucketsQuantity) {
+    return index;
+  }
+  int offset = index - kSubBucketsQuantity;
+  int magnitude = offset / kHalfSubBucketsQuantity + 1;
+  int64_t sub_bucket = offset % kHalfSubBucketsQuantity +
+                       kHalfSubBucketsQuantity;
+  return ((sub_bucket + 1) << magnitude) - 1;
+}
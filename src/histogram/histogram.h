@@ -0,0 +1,55 @@
+#ifndef HISTOGRAM_HISTOGRAM_H_
+#define HISTOGRAM_HISTOGRAM_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace s21 {
+
+constexpr int kSubBucketBits = 7;  // relative error below 2^-(bits - 1)
+constexpr int kSubBucketsQuantity = 1 << kSubBucketBits;
+constexpr int kHalfSubBucketsQuantity = kSubBucketsQuantity / 2;
+constexpr int kHistogramValueBits = 36;  // microseconds, about 19 hours
+constexpr int kBucketsQuantity =
+    kSubBucketsQuantity +
+    (kHistogramValueBits - kSubBucketBits) * kHalfSubBucketsQuantity;
+
+// Log-linear histogram of non-negative values in the manner of HDR
+// histograms. Values below kSubBucketsQuantity get a bucket each, every
+// further power of two is split into kHalfSubBucketsQuantity linear
+// buckets, so a percentile is exact to 1 / kHalfSubBucketsQuantity of its
+// value whatever the number of recorded values. Larger values share the
+// last bucket. The count, minimum, maximum, mean and standard deviation
+// are exact, the last two kept by Welford's method.
+class Histogram {
+ public:
+  // Methods
+  void Record(const int64_t value);
+  void Reset();
+  int64_t CalculatePercentile(const double percentile) const;  // 0 to 100
+
+  // Getters
+  int64_t GetCount() const;
+  int64_t GetMinimum() const;
+  int64_t GetMaximum() const;
+  double GetMean() const;
+  double GetStandardDeviation() const;  // of the population
+
+ private:
+  std::array<int64_t, kBucketsQuantity> counts_{};
+  int64_t count_ = 0;
+  int64_t minimum_ = 0;
+  int64_t maximum_ = 0;
+  double mean_ = 0;
+  double squared_deviations_ = 0;  // sum of (value - mean)^2
+
+ private:
+  int GetIndex(const int64_t value) const;
+  int64_t GetHighestEquivalent(const int index) const;
+};
+
+}  // namespace s21
+
+#endif  // HISTOGRAM_HISTOGRAM_H_
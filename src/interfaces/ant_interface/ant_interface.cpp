@@ -17,6 +17,7 @@ void Interface::GetSolutionHandler() {
   std::cout << "Start solving, it may take some time..." << std::endl;
   results_type results =
       facade_->GetSolution(input_matrix_, iterations_quantity_);
+  last_results_ = results;
   PrintResults(results);
   state_machine_.SetState(s21::States::kChoseMenuOptionHandler);
 }
@@ -44,6 +45,12 @@ void Interface::ExecuteHandlerByCurrentState() {
   ExecuteCommonHandler();
 }
 
+s21::RunConfiguration Interface::GetRunConfiguration() const {
+  return RunConfiguration{"ant", input_matrix_.GetRows(),
+                          input_matrix_.GetColumns(), iterations_quantity_,
+                          kThreadsQuantity};
+}
+
 void Interface::SetupHandlers() {
   handlers_.insert(std::make_pair(s21::States::kWaitSolution,
                                   &Interface::GetSolutionHandler));
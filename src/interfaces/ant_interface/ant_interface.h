@@ -38,6 +38,7 @@ class Interface : public s21::Interface<TsmResult> {
                      const std::string& algorithm_type);
   void ExecuteHandlerByCurrentState();
   void SetupHandlers();
+  RunConfiguration GetRunConfiguration() const;
 };
 
 }  // namespace ant
@@ -17,6 +17,7 @@ void Interface::GetSolutionHandler() {
   std::cout << "Start solving, it may take some time..." << std::endl;
   facade_->SetupMatrix(input_matrix_);
   results_type results = facade_->GetSolution(iterations_quantity_);
+  last_results_ = results;
   PrintResults(results);
   state_machine_.SetState(s21::States::kChoseMenuOptionHandler);
 }
@@ -42,6 +43,12 @@ void Interface::ExecuteHandlerByCurrentState() {
   ExecuteCommonHandler();
 }
 
+s21::RunConfiguration Interface::GetRunConfiguration() const {
+  return RunConfiguration{"gauss", input_matrix_.GetRows(),
+                          input_matrix_.GetColumns(), iterations_quantity_,
+                          kParallelThreadsQuantity};
+}
+
 void Interface::SetupHandlers() {
   handlers_.insert(std::make_pair(s21::States::kWaitSolution,
                                   &Interface::GetSolutionHandler));
@@ -1,12 +1,16 @@
 #ifndef INTERFACE_INTERFACE_H_
 #define INTERFACE_INTERFACE_H_
 
+#include <fstream>
 #include <iostream>
 #include <map>
 
 #include "../matrix.h"
 #include "../state_machine/state_machine.h"
 #include "../algorithm_result/algorithm_result.h"
+#include "../perf_counters/perf_counters.h"
+#include "../result_exporter/result_exporter.h"
+#include "../tracing/tracing.h"
 
 #include "../exceptions/exceptions.h"
 
@@ -19,7 +23,9 @@ constexpr char kConveyorAlgorithmTypeName[] = "Conveyor  ";
 
 enum MenuOptions: int {
    kRunAlgorithmAgain = 1,
-   kQuit
+   kQuit,
+   kExportResults,
+   kToggleThreadCounters
 };
 
 template <class T>
@@ -37,6 +43,7 @@ class Interface {
     Matrix input_matrix_;
     StateMachine state_machine_;
     int iterations_quantity_;
+    results_type last_results_;
     std::map<States, handler_pointer> common_handlers_;
 
  protected:
@@ -50,6 +57,8 @@ class Interface {
     void InputIterationsQuantityHandler();
     void InputMatrixHandler();
     void MenuHandler();
+    void ExportResultsHandler();
+    void ToggleThreadCountersHandler();
     void ExecuteCommonHandler();
 
     void PrintResults(const results_type& results);
@@ -60,6 +69,7 @@ class Interface {
     virtual void GetSolutionHandler() = 0;
     virtual void PrintSolution(const result_type& result, const std::string& algorithm_type) = 0;
     virtual void SetupHandlers() = 0;
+    virtual RunConfiguration GetRunConfiguration() const = 0;
     virtual void ExecuteHandlerByCurrentState() = 0;
 };
 
@@ -84,6 +94,14 @@ void Interface<T>::Execute() {
             state_machine_.SetState(s21::States::kChoseMenuOptionHandler);
         }
     }
+#ifdef S21_TRACING
+    try {
+        WriteTraceFile(kTraceFileName);
+        std::cout << "> Trace is written to " << kTraceFileName << std::endl;
+    } catch (const std::exception& exception) {
+        std::cout << "> ERROR: " << exception.what() << std::endl;
+    }
+#endif
 }
 
 template <typename T>
@@ -115,6 +133,8 @@ void Interface<T>::SetupCommoHandlers() {
     common_handlers_.insert(std::make_pair(s21::States::kInputIterationQuantity, &s21::Interface<T>::InputIterationsQuantityHandler));
     common_handlers_.insert(std::make_pair(s21::States::kInputMatrix, &s21::Interface<T>::InputMatrixHandler));
     common_handlers_.insert(std::make_pair(s21::States::kChoseMenuOptionHandler, &s21::Interface<T>::MenuHandler));
+    common_handlers_.insert(std::make_pair(s21::States::kExportResults, &s21::Interface<T>::ExportResultsHandler));
+    common_handlers_.insert(std::make_pair(s21::States::kToggleThreadCounters, &s21::Interface<T>::ToggleThreadCountersHandler));
 }
 
 template <typename T>
@@ -145,13 +165,21 @@ void Interface<T>::MenuHandler() {
     std::cout << "> Menu:" << std::endl;
     std::cout << "> " << MenuOptions::kRunAlgorithmAgain<< ") Run algorithm again" << std::endl;
     std::cout << "> " << MenuOptions::kQuit<< ") Quit" << std::endl;
+    std::cout << "> " << MenuOptions::kExportResults<< ") Export results" << std::endl;
+    std::cout << "> " << MenuOptions::kToggleThreadCounters << ") "
+              << (AreThreadCountersEnabled() ? "Disable" : "Enable") << " per thread counters" << std::endl;
     while (true) {
         int menu_option = InputNumber();
-        if (menu_option != MenuOptions::kQuit && menu_option != MenuOptions::kRunAlgorithmAgain) {
+        if (menu_option != MenuOptions::kQuit && menu_option != MenuOptions::kRunAlgorithmAgain &&
+            menu_option != MenuOptions::kExportResults && menu_option != MenuOptions::kToggleThreadCounters) {
             std::cout << "> ERROR: invalid menu option. Try again" << std::endl;
         } else {
             if (menu_option == MenuOptions::kRunAlgorithmAgain) {
                 state_machine_.SetState(s21::States::kInputIterationQuantity);
+            } else if (menu_option == MenuOptions::kExportResults) {
+                state_machine_.SetState(s21::States::kExportResults);
+            } else if (menu_option == MenuOptions::kToggleThreadCounters) {
+                state_machine_.SetState(s21::States::kToggleThreadCounters);
             } else {
                 state_machine_.SetState(s21::States::kFinish);
             }
@@ -160,6 +188,56 @@ void Interface<T>::MenuHandler() {
     }
 }
 
+// Appends the results of the last run to a file, a new CSV file starts
+// with its header
+template <typename T>
+void Interface<T>::ExportResultsHandler() {
+    state_machine_.SetState(s21::States::kChoseMenuOptionHandler);
+    if (last_results_.sequential_result.GetTimestampsQuantity() == 0 &&
+        last_results_.parallel_result.GetTimestampsQuantity() == 0) {
+        throw s21::ExportFailure();
+    }
+    std::cout << "> Chose export format:" << std::endl;
+    std::cout << "> " << static_cast<int>(ExportFormat::kJsonLines) << ") JSON Lines" << std::endl;
+    std::cout << "> " << static_cast<int>(ExportFormat::kCsv) << ") CSV" << std::endl;
+    int export_format = InputNumber();
+    while (export_format != static_cast<int>(ExportFormat::kJsonLines) &&
+           export_format != static_cast<int>(ExportFormat::kCsv)) {
+        std::cout << "> ERROR: Invalid export format. Try again: ";
+        export_format = InputNumber();
+    }
+    std::cout << "> Input file path: ";
+    std::string path;
+    while (path.empty()) {
+        std::getline(std::cin, path);
+    }
+    std::ofstream file(path, std::ios::app);
+    if (!file) {
+        throw s21::ExportFailure();
+    }
+    file.seekp(0, std::ios::end);
+    ResultExporter<T> exporter(&file, static_cast<ExportFormat>(export_format), true);
+    if (file.tellp() == 0) {
+        exporter.ExportHeader();
+    }
+    exporter.Export(last_results_, GetRunConfiguration());
+    file.flush();
+    if (!file) {
+        throw s21::ExportFailure();
+    }
+    std::cout << "> Results are exported to " << path << std::endl;
+}
+
+// Counting a worker opens its counters on every start, so the counters of
+// the workers are off until asked for and apply from the next run
+template <typename T>
+void Interface<T>::ToggleThreadCountersHandler() {
+    EnableThreadCounters(!AreThreadCountersEnabled());
+    std::cout << "> Per thread counters are "
+              << (AreThreadCountersEnabled() ? "enabled" : "disabled") << std::endl;
+    state_machine_.SetState(s21::States::kChoseMenuOptionHandler);
+}
+
 template <typename T>
 void Interface<T>::ExecuteCommonHandler() {
     s21::States current_state = state_machine_.GetState();
@@ -192,6 +270,8 @@ void Interface<T>::PrintTotalExecutionTime(const result_type& result, const std:
 template <typename T>
 void Interface<T>::PrintAverageTime(const result_type& result, const std::string& algorithm_type) {
    result.PrintAverageTime();
+   result.PrintTimeDistribution();
+   result.PrintCounters();
 }
 
 // Handlers
@@ -18,6 +18,7 @@ void Interface::GetSolutionHandler() {
             << std::endl;
   s21::winograd::Interface::results_type results = facade_->GetSolution(
       input_matrix_, second_matrix_, iterations_quantity_, threads_quantity_);
+  last_results_ = results;
   std::cout << "First matrix: " << std::endl;
   input_matrix_.Print();
   std::cout << std::endl;
@@ -115,6 +116,13 @@ void Interface::ExecuteHandlerByCurrentState() {
   ExecuteCommonHandler();
 }
 
+// The sizes are those of the product
+s21::RunConfiguration Interface::GetRunConfiguration() const {
+  return RunConfiguration{"winograd", input_matrix_.GetRows(),
+                          second_matrix_.GetColumns(), iterations_quantity_,
+                          threads_quantity_};
+}
+
 void Interface::SetupHandlers() {
   handlers_.insert(
       std::make_pair(States::kInputMatrix, &Interface::InputThreadsQuantity));
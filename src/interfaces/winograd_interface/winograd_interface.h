@@ -48,6 +48,7 @@ class Interface : public s21::Interface<Matrix> {
                      const std::string& algorithm_type);
   void ExecuteHandlerByCurrentState();
   void SetupHandlers();
+  RunConfiguration GetRunConfiguration() const;
 };
 
 }  // namespace winograd
@@ -27,9 +27,21 @@ Matrix::Matrix(size_type rows, size_type columns, value_type default_value)
   }
 }
 
-Matrix::Matrix(const_reference other) { *this = other; }
+Matrix::Matrix(const_reference other)
+    : rows_(kDefaultRows),
+      columns_(kDefaultColumns),
+      values_(nullptr),
+      cached_values_(nullptr) {
+  *this = other;
+}
 
-Matrix::Matrix(rvalue other) { *this = std::move(other); }
+Matrix::Matrix(rvalue other)
+    : rows_(kDefaultRows),
+      columns_(kDefaultColumns),
+      values_(nullptr),
+      cached_values_(nullptr) {
+  *this = std::move(other);
+}
 
 Matrix::~Matrix() { DeleteValues(); }
 
@@ -42,6 +54,7 @@ typename Matrix::reference Matrix::operator=(const_reference other) {
 
 typename Matrix::reference Matrix::operator=(rvalue other) {
   if (this != &other) {
+    DeleteValues();
     rows_ = other.rows_;
     columns_ = other.columns_;
     values_ = other.values_;
@@ -58,37 +71,49 @@ void Matrix::AllocateValues() {
   if (rows_ == 0 || columns_ == 0) {
     throw InvalidMatrixSizes();
   }
+  // Rows point into one contiguous block, so whole matrices are copied with a
+  // single memcpy
   values_ = new value_type*[rows_];
   cached_values_ = new value_type*[rows_];
-  for (size_type i = 0; i < rows_; i++) {
-    values_[i] = new value_type[columns_]{};
-    cached_values_[i] = new value_type[columns_]{};
+  values_[0] = new value_type[rows_ * columns_]{};
+  cached_values_[0] = new value_type[rows_ * columns_]{};
+  for (size_type i = 1; i < rows_; i++) {
+    values_[i] = values_[0] + i * columns_;
+    cached_values_[i] = cached_values_[0] + i * columns_;
   }
 }
 
 void Matrix::DeleteValues() {
   if (values_) {
-    for (size_type i = 0; i < rows_; ++i) {
-      delete[] values_[i];
-    }
+    delete[] values_[0];
     delete[] values_;
     values_ = nullptr;
   }
+  if (cached_values_) {
+    delete[] cached_values_[0];
+    delete[] cached_values_;
+    cached_values_ = nullptr;
+  }
 }
 
 void Matrix::Copy(const_reference other) {
+  DeleteValues();
   rows_ = other.rows_;
   columns_ = other.columns_;
+  if (other.values_ == nullptr) {
+    return;
+  }
   AllocateValues();
   CopyMatrixValues(other);
 }
 
 void Matrix::CopyMatrixValues(const_reference src) {
-  for (size_type n = 0; n < rows_ * columns_; n++) {
-    size_type i = n / columns_, j = n % columns_;
-    values_[i][j] = src.values_[i][j];
-    cached_values_[i][j] = src.cached_values_[i][j];
-  }
+  std::memcpy(values_[0], src.values_[0], GetValuesSize());
+  std::memcpy(cached_values_[0], src.cached_values_[0], GetValuesSize());
+}
+
+std::size_t Matrix::GetValuesSize() const {
+  return sizeof(value_type) * rows_ * columns_;
 }
 
 typename Matrix::value_type& Matrix::operator()(const size_type i,
@@ -183,27 +208,40 @@ bool Matrix::isEqual(const Matrix& other) {
   return is_equal;
 }
 
+// A row is formatted into one buffer and the stream is flushed once, after
+// the last row. A value longer than the buffer, as a huge one printed in
+// full, is formatted again into a string of its length
 void Matrix::Print() {
+  std::string row;
+  char value[32];
   for (size_type i = 0; i < rows_; ++i) {
+    row.clear();
     for (size_type j = 0; j < columns_; ++j) {
-      std::printf("%8.2lf ", values_[i][j]);
+      int length =
+          std::snprintf(value, sizeof(value), "%8.2lf ", values_[i][j]);
+      if (length < static_cast<int>(sizeof(value))) {
+        row.append(value, length);
+        continue;
+      }
+      std::string long_value(length + 1, '\0');
+      std::snprintf(&long_value[0], long_value.size(), "%8.2lf ",
+                    values_[i][j]);
+      row.append(long_value, 0, length);
     }
-    std::cout << std::endl;
+    row += '\n';
+    std::cout.write(row.data(), row.size());
   }
+  std::cout.flush();
 }
 
 void Matrix::CacheValues() {
-  for (size_type i = 0; i < rows_; ++i) {
-    for (size_type j = 0; j < columns_; ++j) {
-      cached_values_[i][j] = values_[i][j];
-    }
+  if (values_) {
+    std::memcpy(cached_values_[0], values_[0], GetValuesSize());
   }
 }
 
 void Matrix::GetValuesFromCache() {
-  for (size_type i = 0; i < rows_; ++i) {
-    for (size_type j = 0; j < columns_; ++j) {
-      values_[i][j] = cached_values_[i][j];
-    }
+  if (values_) {
+    std::memcpy(values_[0], cached_values_[0], GetValuesSize());
   }
 }
@@ -2,8 +2,11 @@
 #define MATRIX_H_
 
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <random>
+#include <string>
 
 #include "exceptions/exceptions.h"
 
@@ -44,6 +47,11 @@ class Matrix {
   void InputValues();
   void SetValue(const size_type i, const size_type j, const value_type value);
 
+  // Snapshot of the values for algorithms that work in place: CacheValues
+  // saves the current values, GetValuesFromCache restores them
+  void CacheValues();
+  void GetValuesFromCache();
+
   // Getters
   size_type GetRows() const;
   size_type GetColumns() const;
@@ -63,8 +71,7 @@ class Matrix {
   void Copy(const_reference other);
   void CopyMatrixValues(const_reference src);
   double GenerateRandomNumber();
-  void CacheValues();
-  void GetValuesFromCache();
+  std::size_t GetValuesSize() const;
 };
 
 }  // namespace s21
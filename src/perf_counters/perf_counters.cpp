@@ -0,0 +1,170 @@
+#include "perf_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+
+using s21::PerfCounters;
+using s21::PerfSample;
+using s21::ScopedThreadCounters;
+
+// Read by every thread that starts counting, written by the caller only
+static std::atomic<bool> are_thread_counters_enabled{false};
+
+// PerfSample
+
+// Methods
+PerfSample& PerfSample::operator+=(const PerfSample& other) {
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    values[i] += other.values[i];
+    is_available[i] = samples_quantity == 0
+                          ? other.is_available[i]
+                          : is_available[i] && other.is_available[i];
+  }
+  samples_quantity += other.samples_quantity;
+  return *this;
+}
+
+int64_t PerfSample::GetValue(const PerfEvent event) const {
+  return values[static_cast<int>(event)];
+}
+
+bool PerfSample::IsAvailable(const PerfEvent event) const {
+  return is_available[static_cast<int>(event)];
+}
+
+bool PerfSample::IsAnyAvailable() const {
+  for (bool is_event_available : is_available) {
+    if (is_event_available) return true;
+  }
+  return false;
+}
+
+// PerfCounters
+
+// Constructors
+PerfCounters::PerfCounters(const bool is_inherited) {
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    descriptors_[i] = OpenEvent(i, is_inherited);
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  for (int descriptor : descriptors_) {
+    if (descriptor >= 0) close(descriptor);
+  }
+}
+
+// Methods
+
+// The counters run from their opening. Resetting an inherited counter
+// would keep the counts of the joined threads, so a sample is the
+// difference from the readings of Begin instead
+void PerfCounters::Begin() {
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    is_begun_[i] = Read(i, &readings_[i]);
+  }
+}
+
+// The counts are scaled by the share of the enabled time the counter was
+// running, not being when the kernel multiplexed it. One that did not run
+// at all is unavailable
+PerfSample PerfCounters::Sample() const {
+  PerfSample sample;
+  sample.samples_quantity = 1;
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    Reading reading;
+    if (!is_begun_[i] || !Read(i, &reading)) {
+      continue;
+    }
+    uint64_t value = reading.value - readings_[i].value;
+    uint64_t time_enabled = reading.time_enabled - readings_[i].time_enabled;
+    uint64_t time_running = reading.time_running - readings_[i].time_running;
+    if (time_running == 0) {
+      sample.is_available[i] = time_enabled == 0;
+      continue;
+    }
+    sample.values[i] =
+        time_running < time_enabled
+            ? static_cast<int64_t>(static_cast<double>(value) * time_enabled /
+                                   time_running)
+            : static_cast<int64_t>(value);
+    sample.is_available[i] = true;
+  }
+  return sample;
+}
+
+// Getters
+bool PerfCounters::IsAvailable() const {
+  for (int descriptor : descriptors_) {
+    if (descriptor >= 0) return true;
+  }
+  return false;
+}
+
+// Private functions
+
+// Hardware events count user space only, which an unprivileged process may
+// always do. Context switches happen in the kernel and are not seen from
+// user space, so they are counted with the kernel or not at all
+int PerfCounters::OpenEvent(const int index, const bool is_inherited) const {
+  constexpr uint32_t types[kPerfEventsQuantity] = {
+      PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE};
+  constexpr uint64_t configs[kPerfEventsQuantity] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+      PERF_COUNT_SW_CONTEXT_SWITCHES};
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = types[index];
+  attributes.config = configs[index];
+  attributes.inherit = is_inherited;
+  attributes.exclude_kernel = attributes.type == PERF_TYPE_HARDWARE;
+  attributes.exclude_hv = 1;
+  attributes.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+bool PerfCounters::Read(const int index, Reading* reading) const {
+  return descriptors_[index] >= 0 &&
+         read(descriptors_[index], reading, sizeof(Reading)) ==
+             sizeof(Reading);
+}
+
+// ScopedThreadCounters
+
+// Constructors
+ScopedThreadCounters::ScopedThreadCounters(PerfSample* sample)
+    : sample_(sample) {
+  if (AreThreadCountersEnabled()) {
+    counters_.reset(new PerfCounters(false));
+    counters_->Begin();
+  }
+}
+
+ScopedThreadCounters::~ScopedThreadCounters() {
+  if (counters_) {
+    *sample_ += counters_->Sample();
+  }
+}
+
+void s21::EnableThreadCounters(const bool is_enabled) {
+  are_thread_counters_enabled = is_enabled;
+}
+
+bool s21::AreThreadCountersEnabled() { return are_thread_counters_enabled; }
+
+// Called before the workers start, a slot must not move while one counts
+void s21::ReserveThreadCounters(std::vector<PerfSample>* samples,
+                                const size_t workers_quantity) {
+  if (samples->size() < workers_quantity) {
+    samples->resize(workers_quantity);
+  }
+}
@@ -0,0 +1,100 @@
+#ifndef PERF_COUNTERS_PERF_COUNTERS_H_
+#define PERF_COUNTERS_PERF_COUNTERS_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace s21 {
+
+enum class PerfEvent : int {
+  kCycles = 0,
+  kInstructions,
+  kCacheMisses,  // of the last level cache
+  kBranchMisses,
+  kContextSwitches,
+};
+
+constexpr int kPerfEventsQuantity = 5;
+constexpr const char* kPerfEventNames[kPerfEventsQuantity] = {
+    "cycles", "instructions", "llc_misses", "branch_misses",
+    "context_switches"};
+
+// Counted values of the events. An event that could not be opened keeps
+// zero and is not available, so a sum is available only where all of its
+// samples were
+struct PerfSample {
+  std::array<int64_t, kPerfEventsQuantity> values{};
+  std::array<bool, kPerfEventsQuantity> is_available{};
+  int64_t samples_quantity = 0;
+
+  PerfSample& operator+=(const PerfSample& other);
+  int64_t GetValue(const PerfEvent event) const;
+  bool IsAvailable(const PerfEvent event) const;
+  bool IsAnyAvailable() const;
+};
+
+// User space counters of the calling thread opened with perf_event_open,
+// used like a Timer: Begin marks a start, Sample reads the counts since. An
+// inherited set also counts the threads started after its opening, once
+// they are joined. Counters multiplexed by the kernel are scaled by their
+// running time. Where perf events are missing or forbidden, as in many
+// containers, the events are unavailable and a sample is empty
+class PerfCounters {
+ public:
+  // Constructors
+  explicit PerfCounters(const bool is_inherited);
+  PerfCounters(const PerfCounters& other) = delete;
+  PerfCounters& operator=(const PerfCounters& other) = delete;
+  ~PerfCounters();
+
+  // Methods
+  void Begin();
+  PerfSample Sample() const;
+
+  // Getters
+  bool IsAvailable() const;
+
+ private:
+  // The layout of a read with the enabled and running times
+  struct Reading {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+  };
+
+ private:
+  std::array<int, kPerfEventsQuantity> descriptors_;
+  std::array<Reading, kPerfEventsQuantity> readings_{};
+  std::array<bool, kPerfEventsQuantity> is_begun_{};
+
+ private:
+  int OpenEvent(const int index, const bool is_inherited) const;
+  bool Read(const int index, Reading* reading) const;
+};
+
+// Adds the counters of the calling thread from its construction to its
+// destruction to a sample. Opening counters costs a few system calls per
+// thread, so nothing is counted unless thread counters are enabled
+class ScopedThreadCounters {
+ public:
+  // Constructors
+  explicit ScopedThreadCounters(PerfSample* sample);
+  ScopedThreadCounters(const ScopedThreadCounters& other) = delete;
+  ScopedThreadCounters& operator=(const ScopedThreadCounters& other) = delete;
+  ~ScopedThreadCounters();
+
+ private:
+  PerfSample* sample_;
+  std::unique_ptr<PerfCounters> counters_;
+};
+
+void EnableThreadCounters(const bool is_enabled);
+bool AreThreadCountersEnabled();
+void ReserveThreadCounters(std::vector<PerfSample>* samples,
+                           const size_t workers_quantity);
+
+}  // namespace s21
+
+#endif  // PERF_COUNTERS_PERF_COUNTERS_H_
@@ -0,0 +1,64 @@
+#include "result_exporter.h"
+
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <thread>
+
+// The model name of the first processor in /proc/cpuinfo, empty elsewhere
+s21::HostInfo s21::GetHostInfo() {
+  HostInfo host_info;
+  char hostname[256] = {};
+  if (gethostname(hostname, sizeof(hostname) - 1) == 0) {
+    host_info.hostname = hostname;
+  }
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.compare(0, 10, "model name") == 0) {
+      size_t colon = line.find(':');
+      if (colon != std::string::npos) {
+        host_info.cpu_model = line.substr(line.find_first_not_of(' ', colon + 1));
+      }
+      break;
+    }
+  }
+  utsname system_name;
+  if (uname(&system_name) == 0) {
+    host_info.operating_system =
+        std::string(system_name.sysname) + " " + system_name.release;
+  }
+#if defined(__clang__)
+  host_info.compiler = __VERSION__;
+#elif defined(__GNUC__)
+  host_info.compiler = std::string("GCC ") + __VERSION__;
+#endif
+  host_info.hardware_threads = std::thread::hardware_concurrency();
+  return host_info;
+}
+
+uint64_t s21::HashBytes(const void* bytes, const size_t size,
+                        uint64_t digest) {
+  const unsigned char* data = static_cast<const unsigned char*>(bytes);
+  for (size_t i = 0; i < size; ++i) {
+    digest = (digest ^ data[i]) * kDigestPrime;
+  }
+  return digest;
+}
+
+uint64_t s21::CalculateDigest(const std::vector<double>& solution) {
+  return HashBytes(solution.data(), solution.size() * sizeof(double),
+                   kDigestOffsetBasis);
+}
+
+// The sizes are hashed with the values, so a transposed matrix differs
+uint64_t s21::CalculateDigest(const Matrix& solution) {
+  int64_t sizes[] = {solution.GetRows(), solution.GetColumns()};
+  uint64_t digest = HashBytes(sizes, sizeof(sizes), kDigestOffsetBasis);
+  for (Matrix::size_type i = 0; i < solution.GetRows(); ++i) {
+    digest = HashBytes(&solution(i, 0), solution.GetColumns() * sizeof(double),
+                       digest);
+  }
+  return digest;
+}
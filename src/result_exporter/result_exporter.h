@@ -0,0 +1,253 @@
+#ifndef RESULT_EXPORTER_RESULT_EXPORTER_H_
+#define RESULT_EXPORTER_RESULT_EXPORTER_H_
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../algorithm_result/algorithm_result.h"
+#include "../matrix.h"
+
+namespace s21 {
+
+constexpr uint64_t kDigestOffsetBasis = 14695981039346656037ULL;  // FNV-1a
+constexpr uint64_t kDigestPrime = 1099511628211ULL;
+constexpr char kSequentialModeName[] = "sequential";
+constexpr char kParallelModeName[] = "parallel";
+constexpr char kConveyorModeName[] = "conveyor";
+constexpr int kExportedDoubleDigits = 17;  // enough to read a double back
+
+enum class ExportFormat : int {
+  kJsonLines = 1,  // one object per mode
+  kCsv,            // one row per mode, the header before the first row
+};
+
+// What was run. Sequential rows always report one thread
+struct RunConfiguration {
+  std::string algorithm;
+  int rows{0};
+  int columns{0};
+  int iterations_quantity{0};
+  int threads_quantity{1};  // of the parallel and conveyor modes
+};
+
+struct HostInfo {
+  std::string hostname;
+  std::string cpu_model;
+  std::string operating_system;
+  std::string compiler;
+  unsigned hardware_threads{0};
+};
+
+HostInfo GetHostInfo();
+uint64_t HashBytes(const void* bytes, const size_t size, uint64_t digest);
+uint64_t CalculateDigest(const std::vector<double>& solution);
+uint64_t CalculateDigest(const Matrix& solution);
+
+// Writes the timings and perf counter averages of AlgorithmResults with
+// the run configuration, the host and optionally a 64-bit FNV-1a digest of
+// each solution, one record per mode that ran. Records are built in a
+// string and written at once, so a dashboard may ingest files with
+// thousands of runs. A solution type is digested by a CalculateDigest
+// overload found next to it
+template <class T>
+class ResultExporter {
+ public:
+  using result_type = AlgorithmResult<T>;
+  using results_type = AlgorithmResults<result_type>;
+
+ public:
+  // Constructors
+  ResultExporter(std::ostream* stream, const ExportFormat format,
+                 const bool has_digest);
+
+  // Methods
+  void Export(const results_type& results,
+              const RunConfiguration& configuration);
+  void Export(const result_type& result, const std::string& mode,
+              const int threads_quantity,
+              const RunConfiguration& configuration);
+  void ExportHeader();
+
+ private:
+  std::ostream* stream_;
+  ExportFormat format_;
+  bool has_digest_;
+  HostInfo host_info_;
+  std::string record_;
+  bool is_first_field_ = true;
+
+ private:
+  void AddField(const char* name, const std::string& value);
+  void AddField(const char* name, const int64_t value);
+  void AddField(const char* name, const double value);
+  void AddCounterFields(const PerfSample& sample);
+  void AddName(const char* name);
+  void AddQuoted(const std::string& value);
+};
+
+// Constructors
+template <typename T>
+ResultExporter<T>::ResultExporter(std::ostream* stream,
+                                  const ExportFormat format,
+                                  const bool has_digest)
+    : stream_(stream),
+      format_(format),
+      has_digest_(has_digest),
+      host_info_(GetHostInfo()) {}
+
+// Methods
+
+// Modes without timestamps, like the conveyor of the algorithms that have
+// none, are skipped
+template <typename T>
+void ResultExporter<T>::Export(const results_type& results,
+                               const RunConfiguration& configuration) {
+  Export(results.sequential_result, kSequentialModeName, 1, configuration);
+  Export(results.parallel_result, kParallelModeName,
+         configuration.threads_quantity, configuration);
+  Export(results.conveyor_results, kConveyorModeName,
+         configuration.threads_quantity, configuration);
+}
+
+template <typename T>
+void ResultExporter<T>::Export(const result_type& result,
+                               const std::string& mode,
+                               const int threads_quantity,
+                               const RunConfiguration& configuration) {
+  if (result.GetTimestampsQuantity() == 0) {
+    return;
+  }
+  record_.clear();
+  is_first_field_ = true;
+  if (format_ == ExportFormat::kJsonLines) {
+    record_ += '{';
+  }
+  AddField("algorithm", configuration.algorithm);
+  AddField("mode", mode);
+  AddField("rows", int64_t{configuration.rows});
+  AddField("columns", int64_t{configuration.columns});
+  AddField("iterations", int64_t{configuration.iterations_quantity});
+  AddField("threads", int64_t{threads_quantity});
+  AddField("timestamps", result.GetTimestampsQuantity());
+  AddField("total_us", result.GetTotalExecutionTime().GetMicroseconds());
+  AddField("mean_us", result.GetTimeHistogram().GetMean());
+  AddField("stddev_us", result.CalculateStandardDeviation());
+  AddField("min_us", result.GetMinimumTime().GetMicroseconds());
+  AddField("p50_us", result.CalculatePercentileTime(50).GetMicroseconds());
+  AddField("p90_us", result.CalculatePercentileTime(90).GetMicroseconds());
+  AddField("p99_us", result.CalculatePercentileTime(99).GetMicroseconds());
+  AddField("p99_9_us", result.CalculatePercentileTime(99.9).GetMicroseconds());
+  AddField("max_us", result.GetMaximumTime().GetMicroseconds());
+  AddCounterFields(result.CalculateAverageCounters());
+  AddField("hostname", host_info_.hostname);
+  AddField("cpu", host_info_.cpu_model);
+  AddField("hardware_threads", int64_t{host_info_.hardware_threads});
+  AddField("os", host_info_.operating_system);
+  AddField("compiler", host_info_.compiler);
+  if (has_digest_) {
+    char digest[sizeof(uint64_t) * 2 + 1];
+    std::snprintf(digest, sizeof(digest), "%016" PRIx64,
+                  CalculateDigest(result.GetSolution()));
+    AddField("digest", std::string(digest));
+  }
+  record_ += format_ == ExportFormat::kJsonLines ? "}\n" : "\n";
+  stream_->write(record_.data(), record_.size());
+}
+
+// The CSV header, in the order of the fields of a record
+template <typename T>
+void ResultExporter<T>::ExportHeader() {
+  if (format_ != ExportFormat::kCsv) {
+    return;
+  }
+  std::string header =
+      "algorithm,mode,rows,columns,iterations,threads,timestamps,total_us,"
+      "mean_us,stddev_us,min_us,p50_us,p90_us,p99_us,p99_9_us,max_us,";
+  for (const char* name : kPerfEventNames) {
+    header += name;
+    header += ',';
+  }
+  header += "hostname,cpu,hardware_threads,os,compiler";
+  header += has_digest_ ? ",digest\n" : "\n";
+  stream_->write(header.data(), header.size());
+}
+
+// Private functions
+template <typename T>
+void ResultExporter<T>::AddField(const char* name, const std::string& value) {
+  AddName(name);
+  AddQuoted(value);
+}
+
+template <typename T>
+void ResultExporter<T>::AddField(const char* name, const int64_t value) {
+  AddName(name);
+  record_ += std::to_string(value);
+}
+
+template <typename T>
+void ResultExporter<T>::AddField(const char* name, const double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.*g", kExportedDoubleDigits, value);
+  AddName(name);
+  record_ += buffer;
+}
+
+// The averages per iteration. An unavailable event is null in JSON and
+// empty in CSV
+template <typename T>
+void ResultExporter<T>::AddCounterFields(const PerfSample& sample) {
+  for (int i = 0; i < kPerfEventsQuantity; ++i) {
+    if (sample.is_available[i]) {
+      AddField(kPerfEventNames[i], sample.values[i]);
+      continue;
+    }
+    AddName(kPerfEventNames[i]);
+    if (format_ == ExportFormat::kJsonLines) {
+      record_ += "null";
+    }
+  }
+}
+
+// A CSV record keeps the names in its header only
+template <typename T>
+void ResultExporter<T>::AddName(const char* name) {
+  if (!is_first_field_) {
+    record_ += ',';
+  }
+  is_first_field_ = false;
+  if (format_ == ExportFormat::kJsonLines) {
+    AddQuoted(name);
+    record_ += ':';
+  }
+}
+
+// JSON escapes quotes, backslashes and control characters, CSV doubles
+// its quotes
+template <typename T>
+void ResultExporter<T>::AddQuoted(const std::string& value) {
+  record_ += '"';
+  for (const char symbol : value) {
+    if (format_ == ExportFormat::kCsv) {
+      record_ += symbol == '"' ? "\"\"" : std::string(1, symbol);
+    } else if (symbol == '"' || symbol == '\\') {
+      record_ += '\\';
+      record_ += symbol;
+    } else if (static_cast<unsigned char>(symbol) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", symbol);
+      record_ += escaped;
+    } else {
+      record_ += symbol;
+    }
+  }
+  record_ += '"';
+}
+
+}  // namespace s21
+
+#endif  // RESULT_EXPORTER_RESULT_EXPORTER_H_
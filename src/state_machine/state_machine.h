@@ -17,6 +17,8 @@ enum class States : int {
   kChoseMenuOptionHandler,
   kInputThreadQuantity,
   kWaitSolution,
+  kExportResults,
+  kToggleThreadCounters,
   kFinish,
 };
 
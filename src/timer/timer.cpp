@@ -12,3 +12,9 @@ s21::TimeRange Timer::Timestamp() {
                                                             begin_time_);
   return TimeRange(duration);
 }
+
+int64_t Timer::GetNanoseconds() const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::high_resolution_clock::now() - begin_time_)
+      .count();
+}
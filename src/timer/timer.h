@@ -10,6 +10,7 @@ class Timer {
   // Functions
   void Begin();
   TimeRange Timestamp();
+  int64_t GetNanoseconds() const;  // since Begin
 
  private:
   std::chrono::_V2::system_clock::time_point begin_time_;
@@ -0,0 +1,172 @@
+#include "tracing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "../exceptions/exceptions.h"
+
+using s21::TraceBuffer;
+using s21::TraceRegistry;
+using s21::TraceScope;
+using s21::TraceThread;
+
+static thread_local TraceThread trace_thread;
+
+// TraceBuffer
+
+// Constructors
+TraceBuffer::TraceBuffer(const int lane)
+    : events_(kTraceBufferCapacity), lane_(lane) {}
+
+// Methods
+void TraceBuffer::Record(const char* name, const int64_t begin,
+                         const int64_t end) {
+  int64_t quantity = recorded_quantity_.load(std::memory_order_relaxed);
+  events_[quantity % kTraceBufferCapacity] = TraceEvent{name, begin, end};
+  recorded_quantity_.store(quantity + 1, std::memory_order_release);
+}
+
+void TraceBuffer::Clear() { recorded_quantity_ = 0; }
+
+// The kept events, oldest first
+void TraceBuffer::CopyEvents(std::vector<TraceEvent>* events) const {
+  int64_t quantity = recorded_quantity_.load(std::memory_order_acquire);
+  for (int64_t i = std::max<int64_t>(0, quantity - kTraceBufferCapacity);
+       i < quantity; ++i) {
+    events->push_back(events_[i % kTraceBufferCapacity]);
+  }
+}
+
+// Getters
+int TraceBuffer::GetLane() const { return lane_; }
+
+int64_t TraceBuffer::GetDroppedQuantity() const {
+  return std::max<int64_t>(0, recorded_quantity_ - kTraceBufferCapacity);
+}
+
+// TraceScope
+
+// Constructors
+
+// The buffer is taken when the first scope of a thread begins, so the
+// threads sharing a lane never overlap in time
+TraceScope::TraceScope(const char* name)
+    : name_(name), buffer_(GetThreadTraceBuffer()), begin_(GetTraceTime()) {}
+
+TraceScope::~TraceScope() { buffer_->Record(name_, begin_, GetTraceTime()); }
+
+// TraceRegistry
+
+// Constructors
+TraceRegistry::TraceRegistry() { epoch_timer_.Begin(); }
+
+// Methods
+TraceBuffer* TraceRegistry::AcquireBuffer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_buffers_.empty()) {
+    buffers_.push_back(std::make_unique<TraceBuffer>(buffers_.size()));
+    return buffers_.back().get();
+  }
+  TraceBuffer* buffer = free_buffers_.back();
+  free_buffers_.pop_back();
+  return buffer;
+}
+
+void TraceRegistry::ReleaseBuffer(TraceBuffer* buffer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  free_buffers_.push_back(buffer);
+}
+
+// Only while no thread records
+void TraceRegistry::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (std::unique_ptr<TraceBuffer>& buffer : buffers_) {
+    buffer->Clear();
+  }
+}
+
+// Chrome trace event format: a complete event per scope with its start and
+// duration in microseconds, a name per lane and the number of events lost
+// to full buffers. Opens in chrome://tracing and ui.perfetto.dev. Only
+// while no thread records
+void TraceRegistry::Write(std::ostream* stream) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  int64_t dropped_quantity = 0;
+  char line[256];
+  std::vector<TraceEvent> events;
+  for (std::unique_ptr<TraceBuffer>& buffer : buffers_) {
+    std::snprintf(line, sizeof(line),
+                  "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                  "\"tid\":%d,\"args\":{\"name\":\"lane %d\"}}",
+                  buffer->GetLane() == 0 ? "" : ",", buffer->GetLane(),
+                  buffer->GetLane());
+    json += line;
+    dropped_quantity += buffer->GetDroppedQuantity();
+    events.clear();
+    buffer->CopyEvents(&events);
+    std::sort(events.begin(), events.end(),
+              [](const TraceEvent& first, const TraceEvent& second) {
+                return first.begin < second.begin ||
+                       (first.begin == second.begin && first.end > second.end);
+              });
+    for (const TraceEvent& event : events) {
+      std::snprintf(line, sizeof(line),
+                    ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                    "\"ts\":%.3f,\"dur\":%.3f}",
+                    event.name, buffer->GetLane(), event.begin / 1000.0,
+                    (event.end - event.begin) / 1000.0);
+      json += line;
+    }
+  }
+  std::snprintf(line, sizeof(line),
+                "],\"otherData\":{\"dropped_events\":%lld}}\n",
+                static_cast<long long>(dropped_quantity));
+  json += line;
+  stream->write(json.data(), json.size());
+}
+
+// Getters
+int64_t TraceRegistry::GetTime() const {
+  return epoch_timer_.GetNanoseconds();
+}
+
+// TraceThread
+
+// Constructors
+TraceThread::~TraceThread() {
+  if (buffer_ != nullptr) {
+    GetTraceRegistry().ReleaseBuffer(buffer_);
+  }
+}
+
+// Getters
+TraceBuffer* TraceThread::GetBuffer() {
+  if (buffer_ == nullptr) {
+    buffer_ = GetTraceRegistry().AcquireBuffer();
+  }
+  return buffer_;
+}
+
+TraceRegistry& s21::GetTraceRegistry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+int64_t s21::GetTraceTime() { return GetTraceRegistry().GetTime(); }
+
+TraceBuffer* s21::GetThreadTraceBuffer() { return trace_thread.GetBuffer(); }
+
+void s21::ClearTrace() { GetTraceRegistry().Clear(); }
+
+void s21::WriteTrace(std::ostream* stream) { GetTraceRegistry().Write(stream); }
+
+void s21::WriteTraceFile(const std::string& path) {
+  std::ofstream file(path);
+  GetTraceRegistry().Write(&file);
+  file.flush();
+  if (!file) {
+    throw s21::TraceWriteFailure();
+  }
+}
@@ -0,0 +1,130 @@
+#ifndef TRACING_TRACING_H_
+#define TRACING_TRACING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../timer/timer.h"
+
+// S21_TRACE_SCOPE("name") records the time from the macro to the end of
+// its scope on the calling thread. The name must outlive the trace, a
+// string literal does. Without S21_TRACING the macro expands to nothing
+#ifdef S21_TRACING
+#define S21_TRACE_CONCATENATE_IMPL(first, second) first##second
+#define S21_TRACE_CONCATENATE(first, second) \
+  S21_TRACE_CONCATENATE_IMPL(first, second)
+#define S21_TRACE_SCOPE(name) \
+  s21::TraceScope S21_TRACE_CONCATENATE(trace_scope_, __LINE__)(name)
+#else
+#define S21_TRACE_SCOPE(name) \
+  do {                        \
+  } while (false)
+#endif
+
+namespace s21 {
+
+constexpr int kTraceBufferCapacity = 1 << 16;  // events per thread
+constexpr char kTraceFileName[] = "trace.json";
+
+struct TraceEvent {
+  const char* name;
+  int64_t begin;  // nanoseconds since the first traced event
+  int64_t end;
+};
+
+// The events of one thread. Only the owning thread records, so a record
+// is a plain store published by a release increment of the counter and
+// needs no lock. When full, the oldest events are overwritten. A reader
+// copies the events once the recording threads are joined
+class TraceBuffer {
+ public:
+  // Constructors
+  explicit TraceBuffer(const int lane);
+
+  // Methods
+  void Record(const char* name, const int64_t begin, const int64_t end);
+  void Clear();
+  void CopyEvents(std::vector<TraceEvent>* events) const;
+
+  // Getters
+  int GetLane() const;
+  int64_t GetDroppedQuantity() const;
+
+ private:
+  std::vector<TraceEvent> events_;
+  std::atomic<int64_t> recorded_quantity_{0};
+  int lane_;  // the tid of the trace
+};
+
+// Records the lifetime of a scope to the buffer of its thread
+class TraceScope {
+ public:
+  // Constructors
+  explicit TraceScope(const char* name);
+  TraceScope(const TraceScope& other) = delete;
+  TraceScope& operator=(const TraceScope& other) = delete;
+  ~TraceScope();
+
+ private:
+  const char* name_;
+  TraceBuffer* buffer_;
+  int64_t begin_;
+};
+
+// Owns the buffers of all threads. A buffer outlives its thread and goes
+// to the next thread that starts tracing, so a program starting a thread
+// per row keeps only as many buffers as it ran threads at once, and a lane
+// of the trace is a worker slot rather than one thread
+class TraceRegistry {
+ public:
+  // Constructors
+  TraceRegistry();
+
+  // Methods
+  TraceBuffer* AcquireBuffer();
+  void ReleaseBuffer(TraceBuffer* buffer);
+  void Clear();
+  void Write(std::ostream* stream);
+
+  // Getters
+  int64_t GetTime() const;
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers_;
+  std::vector<TraceBuffer*> free_buffers_;
+  Timer epoch_timer_;
+};
+
+// The buffer of a thread, taken on its first event and given back when
+// the thread ends
+class TraceThread {
+ public:
+  // Constructors
+  TraceThread() = default;
+  TraceThread(const TraceThread& other) = delete;
+  TraceThread& operator=(const TraceThread& other) = delete;
+  ~TraceThread();
+
+  // Getters
+  TraceBuffer* GetBuffer();
+
+ private:
+  TraceBuffer* buffer_ = nullptr;
+};
+
+TraceRegistry& GetTraceRegistry();
+int64_t GetTraceTime();
+TraceBuffer* GetThreadTraceBuffer();
+void ClearTrace();
+void WriteTrace(std::ostream* stream);
+void WriteTraceFile(const std::string& path);
+
+}  // namespace s21
+
+#endif  // TRACING_TRACING_H_
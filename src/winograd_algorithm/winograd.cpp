@@ -7,12 +7,18 @@ void Winograd::Solve(std::function<void()> calculation_method,
                      const int iterations_quantity, result_type *result) {
   Timer total_time_timer;
   Timer average_time_timer;
+  PerfCounters iteration_counters(true);
   total_time_timer.Begin();
   for (int i = 0; i < iterations_quantity; ++i) {
+    S21_TRACE_SCOPE("iteration");
+    iteration_counters.Begin();
     average_time_timer.Begin();
     calculation_method();
     s21::TimeRange timestamp = average_time_timer.Timestamp();
     result->AddTimestamp(timestamp);
+    result->AddCounters(iteration_counters.Sample());
+    result->AddThreadCounters(thread_counters_);
+    thread_counters_.clear();
   }
   s21::TimeRange timestamp = total_time_timer.Timestamp();
   result->SetTotalExecutionTime(timestamp);
@@ -72,6 +78,7 @@ int Winograd::GetThreadsQuantity() { return threads_quantity_; }
 
 void Winograd::Calculate(const double *row_factor, const double *column_factor,
                          int n_start, int n_end, Matrix *matrix) {
+  S21_TRACE_SCOPE("row band");
   double result = 0;
   for (int i = n_start; i < n_end; ++i) {
     for (int j = 0; j < matrix->GetColumns(); ++j) {
@@ -98,25 +105,42 @@ void Winograd::WinogradCalculationParallel() {
   double *row_factor = new double[matrix_A_.GetRows()];
   double *column_factor = new double[matrix_B_.GetColumns()];
 
-  std::thread rowCounting(&Winograd::RowFactorCalculation, this, row_factor);
-  std::thread columnCounting(&Winograd::ColumnFactorCalculation, this,
-                             column_factor);
-
-  rowCounting.join();
-  columnCounting.join();
+  // The factor threads count in the first slots, the row bands after them
+  ReserveThreadCounters(&thread_counters_,
+                        kFactorThreadsQuantity + GetThreadsQuantity());
+  std::thread rowCounting([this, row_factor]() {
+    ScopedThreadCounters counters(&thread_counters_[0]);
+    RowFactorCalculation(row_factor);
+  });
+  std::thread columnCounting([this, column_factor]() {
+    ScopedThreadCounters counters(&thread_counters_[1]);
+    ColumnFactorCalculation(column_factor);
+  });
+
+  {
+    S21_TRACE_SCOPE("join");
+    rowCounting.join();
+    columnCounting.join();
+  }
 
   std::vector<std::thread> threads;
 
   for (int i = 1; i <= GetThreadsQuantity(); ++i) {
-    threads.push_back(std::thread(
-        &Winograd::Calculate, this, row_factor, column_factor,
-        (matrix_A_.GetRows() * (i - 1)) / GetThreadsQuantity(),
-        (matrix_A_.GetRows() * i) / GetThreadsQuantity(), &matrix_RP_));
+    threads.push_back(std::thread([this, row_factor, column_factor, i]() {
+      ScopedThreadCounters counters(
+          &thread_counters_[kFactorThreadsQuantity + i - 1]);
+      Calculate(row_factor, column_factor,
+                (matrix_A_.GetRows() * (i - 1)) / GetThreadsQuantity(),
+                (matrix_A_.GetRows() * i) / GetThreadsQuantity(), &matrix_RP_);
+    }));
   }
 
-  for (int i = 0; i < threads.size(); ++i) {
-    if (threads[i].joinable()) {
-      threads[i].join();
+  {
+    S21_TRACE_SCOPE("join");
+    for (int i = 0; i < threads.size(); ++i) {
+      if (threads[i].joinable()) {
+        threads[i].join();
+      }
     }
   }
 
@@ -125,6 +149,7 @@ void Winograd::WinogradCalculationParallel() {
 }
 
 void Winograd::RowFactorCalculation(double *row_factor) {
+  S21_TRACE_SCOPE("row factors");
   for (int i = 0; i < matrix_A_.GetRows(); ++i) {
     row_factor[i] = matrix_A_(i, 0) * matrix_A_(i, 1);
     for (int j = 1; j < matrix_A_.GetColumns() / 2; ++j) {
@@ -135,6 +160,7 @@ void Winograd::RowFactorCalculation(double *row_factor) {
 }
 
 void Winograd::ColumnFactorCalculation(double *column_factor) {
+  S21_TRACE_SCOPE("column factors");
   for (int i = 0; i < matrix_B_.GetColumns(); ++i) {
     column_factor[i] = matrix_B_(0, i) * matrix_B_(1, i);
     for (int j = 1; j < matrix_A_.GetColumns() / 2; ++j) {
@@ -164,19 +190,26 @@ void Winograd::WinogradCalculationConveyor() {
   double *column_factor = new double[matrix_B_.GetColumns()];
 
   std::vector<std::thread> threads;
+  // One slot per stage of the conveyor
+  ReserveThreadCounters(&thread_counters_, kConveyorStagesQuantity);
 
-  threads.push_back(
-      std::thread(&Winograd::RowFactorCalculation, this, row_factor));
+  threads.push_back(std::thread([this, row_factor]() {
+    ScopedThreadCounters counters(&thread_counters_[0]);
+    RowFactorCalculation(row_factor);
+  }));
   threads[0].join();
-  threads.push_back(
-      std::thread(&Winograd::ColumnFactorCalculation, this, column_factor));
+  threads.push_back(std::thread([this, column_factor]() {
+    ScopedThreadCounters counters(&thread_counters_[1]);
+    ColumnFactorCalculation(column_factor);
+  }));
   threads[1].join();
 
   for (int i = 1; i <= 2; ++i) {
-    threads.push_back(std::thread(&Winograd::Calculate, this, row_factor,
-                                  column_factor,
-                                  (matrix_A_.GetRows() * (i - 1)) / 2,
-                                  (matrix_A_.GetRows() * i) / 2, &matrix_RC_));
+    threads.push_back(std::thread([this, row_factor, column_factor, i]() {
+      ScopedThreadCounters counters(&thread_counters_[i + 1]);
+      Calculate(row_factor, column_factor, (matrix_A_.GetRows() * (i - 1)) / 2,
+                (matrix_A_.GetRows() * i) / 2, &matrix_RC_);
+    }));
     threads[threads.size() - 1].join();
   }
 }
@@ -1,6 +1,7 @@
 #ifndef SRC_WINOGRAD_ALG_WINOGRAD_H_
 #define SRC_WINOGRAD_ALG_WINOGRAD_H_
 
+#include <algorithm>
 #include <functional>
 #include <mutex>
 #include <thread>
@@ -10,9 +11,13 @@
 #include "../exceptions/exceptions.h"
 #include "../matrix.h"
 #include "../timer/timer.h"
+#include "../tracing/tracing.h"
 
 namespace s21 {
 
+constexpr int kFactorThreadsQuantity = 2;   // the row and column factors
+constexpr int kConveyorStagesQuantity = 4;  // two factors, two row halves
+
 class Winograd {
  public:
   using solution_type = Matrix;
@@ -38,6 +43,7 @@ class Winograd {
   result_type sequential_result_;
   result_type parallel_result_;
   result_type conveyor_result_;
+  std::vector<PerfSample> thread_counters_;  // of the current iteration
 
  private:
   void MatrixCheck();